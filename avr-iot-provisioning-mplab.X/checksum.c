@@ -0,0 +1,55 @@
+/*
+ *  (c) 2021 Microchip Technology Inc. and its subsidiaries.
+ *
+ *  Subject to your compliance with these terms, you may use Microchip software
+ *  and any derivatives exclusively with Microchip products. You’re responsible
+ *  for complying with 3rd party license terms applicable to your use of 3rd
+ *  party software (including open source software) that may accompany
+ *  Microchip software.
+ *
+ *  SOFTWARE IS “AS IS.” NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+ *  APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF
+ *  NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *  IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ *  INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ *  WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ *  BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+ *  FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL LIABILITY ON ALL CLAIMS
+ *  RELATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID
+ *  DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ */
+
+#include "checksum.h"
+
+// CRC-32 lookup table for the reflected polynomial 0xEDB88320, one nibble at a time.
+// A full 256 entry table would be faster but costs 1 kB of flash
+static const uint32_t crc32_nibble_table[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+    0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+/**
+ * \brief Calculates CRC-32 over a buffer
+ *
+ * \param[in] crc      Checksum of the previous data, 0 for the first block
+ * \param[in] data     Data to add to the checksum
+ * \param[in] length   Number of bytes in data
+ *
+ * \return    The updated checksum
+ */
+uint32_t checksum_crc32(uint32_t crc, const uint8_t *data, uint16_t length)
+{
+    crc = ~crc;
+
+    while (length--)
+    {
+        crc ^= *data++;
+        crc = (crc >> 4) ^ crc32_nibble_table[crc & 0x0F];
+        crc = (crc >> 4) ^ crc32_nibble_table[crc & 0x0F];
+    }
+
+    return ~crc;
+}
@@ -1,8 +1,11 @@
 #include <stdint.h>
 #include <stdio.h>
+#include <inttypes.h>
 #include <avr/io.h>
 
 #include "../mcc_generated_files/include/ccp.h"
+#include "../mcc_generated_files/include/counters.h"
+#include "../mcc_generated_files/include/usart2.h"
 #include "parser/mc_error.h"
 #include "parser/mc_parser.h"
 #include "mc_commands.h"
@@ -14,6 +17,8 @@
 
 #define VERSION_WINC ("WINC")
 
+#define COUNTERS_RESET ("RESET")
+
 static uint8_t parse_leds(const char *ledstr);
 
 static uint16_t get_winc_version_string(char *version_string, uint16_t *version_length);
@@ -120,6 +125,69 @@ uint16_t mc_reset(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_leng
     return MC_STATUS_OK;
 }
 
+/*
+ * Report the hardware operation counters, see counters.h
+ *
+ * One line is returned per counter on the format <name>,<value>, followed by the line
+ * SECTORERASES,<count for sector 0><count for sector 1>... with one hex byte per WINC flash sector.
+ * Reading the counters before and after a host operation shows how much bus and flash work it took.
+ * MC+COUNTERS=RESET clears all counters after reporting them.
+ */
+uint16_t mc_counters(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length)
+{
+    char *report = (char*) data;
+    uint16_t length;
+    uint16_t sector;
+
+    if (argc > 1) {
+        return MC_STATUS_BAD_ARGUMENT_COUNT;
+    }
+
+    if (argc == 1 && !mc_match_string(COUNTERS_RESET, argv[0])) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    length = snprintf(report,
+                      MC_DATA_BUFFER_LENGTH,
+                      "SPIBYTES,%" PRIu32 "\r\n"
+                      "WINCREGREADS,%" PRIu32 "\r\n"
+                      "WINCREGWRITES,%" PRIu32 "\r\n"
+                      "WINCPAGES,%" PRIu32 "\r\n"
+                      "WINCSECTORS,%" PRIu32 "\r\n"
+                      "I2CBYTES,%" PRIu32 "\r\n"
+                      "ECCWAKES,%u\r\n"
+                      "ECCIDLES,%u\r\n"
+                      "ECCRETRIES,%u\r\n"
+                      "UARTOVERRUNS,%u\r\n"
+                      "PARSERERRORS,%u\r\n"
+                      "SECTORERASES,",
+                      counters.spi_bytes,
+                      counters.winc_reg_reads,
+                      counters.winc_reg_writes,
+                      counters.winc_pages_programmed,
+                      counters.winc_sectors_erased,
+                      counters.i2c_bytes,
+                      counters.ecc_wakes,
+                      counters.ecc_idles,
+                      counters.ecc_retries,
+                      USART2_GetRxOverruns(),
+                      counters.parser_errors);
+
+    // The report is well within the buffer, the sector counts need 2 characters each plus the line ending
+    for (sector = 0; sector < COUNTERS_WINC_SECTORS; sector++) {
+        length += snprintf(&report[length], MC_DATA_BUFFER_LENGTH - length, "%02X", counters_get_sector_erases(sector));
+    }
+    length += snprintf(&report[length], MC_DATA_BUFFER_LENGTH - length, "\r\n");
+    *data_length = length;
+
+    if (argc == 1) {
+        counters_clear();
+        USART2_ClearRxOverruns();
+    }
+
+    return MC_STATUS_OK;
+}
+
 // Extension to mc_version in mc_housekeeping for board specific versions
 // The version_arg is the argument to the version command, example:
 // MC+VERSION=WINC - The "WINC" part is the argument to be sent in as the version_arg argument
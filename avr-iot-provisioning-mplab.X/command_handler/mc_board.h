@@ -6,6 +6,7 @@ void mc_board_init( void );
 uint16_t mc_set_led(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
 uint16_t mc_get_led(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
 uint16_t mc_reset(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+uint16_t mc_counters(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
 
 uint16_t get_board_version(char *version_arg, char *version, uint16_t *version_length);
 uint16_t get_board_versions(char *versions, uint16_t *version_length);
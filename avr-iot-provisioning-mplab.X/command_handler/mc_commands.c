@@ -2,7 +2,8 @@
 #include "mc_commands.h"
 
 #include "parser/mc_housekeeping.h"  // for mc_get_version()
-#include "mc_board.h"  // for mc_set_led, mc_get_led, mc_reset
+#include "parser/mc_stats.h"  // for mc_stats()
+#include "mc_board.h"  // for mc_set_led, mc_get_led, mc_reset, mc_counters
 #include "../winc_commands.h" // for WINC related commands
 #include "../ecc_commands.h" // for ECC related commands
 
@@ -12,6 +13,7 @@ const mc_command_t mc_command_set[] = {
     {"MC+ABOUT",mc_about,false},
     {"MC+BLOBTEST",mc_blobtest, true},
     {"MC+PING", mc_ping, false},
+    {"MC+COUNTERS",mc_counters, false},
     {"MC+ECC+GENPUBKEY", cmd_ecc_genpubkey, false},
     {"MC+ECC+LOCK", cmd_ecc_lock, false},
     {"MC+ECC+OTP+READ", cmd_ecc_otp_read, false},
@@ -25,10 +27,29 @@ const mc_command_t mc_command_set[] = {
     {"MC+LISTCOMMANDS",mc_list_commands,false},
     {"MC+RESET",mc_reset, false},
     {"MC+SETLED",mc_set_led, false},
+    {"MC+STATS",mc_stats, false},
+#ifdef MC_TRACE
+    {"MC+TRACE",mc_trace, false},
+#endif
     {"MC+VERSION",mc_get_version, false},
+    {"MC+WINC+ATTEST",cmd_winc_attest, false},
+    {"MC+WINC+AUTOERASE",cmd_winc_autoerase, false},
+    {"MC+WINC+COPY",cmd_winc_copy, false},
     {"MC+WINC+ERASE",cmd_winc_erasesector, false},
+    {"MC+WINC+FILL",cmd_winc_fill, false},
+    {"MC+WINC+FLASHMAP",cmd_winc_flashmap, false},
+    {"MC+WINC+FWVERSION",cmd_winc_fwversion, false},
     {"MC+WINC+READ",cmd_winc_read, false},
-    {"MC+WINC+WRITEBLOB",cmd_winc_writeblob, true}
+    {"MC+WINC+READSTREAM",cmd_winc_readstream, false},
+    {"MC+WINC+RESUME",cmd_winc_resume, false},
+    {"MC+WINC+ROOTCERT+ADD",cmd_winc_rootcert_add, true},
+    {"MC+WINC+ROOTCERT+CLEAR",cmd_winc_rootcert_clear, false},
+    {"MC+WINC+SECTORMAP",cmd_winc_sectormap, false},
+    {"MC+WINC+SPITUNE",cmd_winc_spitune, false},
+    {"MC+WINC+TIMING",cmd_winc_timing, false},
+    {"MC+WINC+VERIFY",cmd_winc_verify, false},
+    {"MC+WINC+WRITEBLOB",cmd_winc_writeblob, true},
+    {"MC+WINC+WRITECOMPRESSED",cmd_winc_writecompressed, true}
 };
 
 uint8_t mc_number_of_commands( void )
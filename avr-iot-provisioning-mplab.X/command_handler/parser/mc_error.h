@@ -8,6 +8,7 @@
 #define MC_STATUS_BAD_ARGUMENT_COUNT 3
 #define MC_STATUS_BAD_BLOB           4
 #define MC_STATUS_BAD_ARGUMENT_VALUE 5
+#define MC_STATUS_VERIFY_FAILED      6
 
 // Convert 8-bit status to 16-bit command handler status
 // source is the module returning the status
@@ -8,6 +8,7 @@
 #include "../mc_board.h"
 #include "../mc_commands.h"
 #include "../mc_argparser.h"
+#include "../../mcc_generated_files/include/trace.h"
 
 #define VERSION_COMMANDHANDLER ("COMMANDHANDLER")
 #define VERSION_FIRMWARE ("FIRMWARE")
@@ -95,3 +96,45 @@ uint16_t mc_list_commands(uint8_t argc, char *argv[], uint8_t *data, uint16_t *d
 
     return MC_STATUS_OK;
 }
+
+
+#ifdef MC_TRACE
+/*
+ * MC+TRACE implementation, empties the trace buffer to the host
+ *
+ * Each entry is streamed as one line, oldest first, on the format
+ * "<start us> <duration us> <value> <length> <event> <status>\r\n" with all fields in hex, see trace.h for the events.
+ * The number of entries and the number of entries overwritten before they could be read are returned as
+ * "ENTRIES <n>\r\nDROPPED <n>\r\n".
+ */
+uint16_t mc_trace(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length)
+{
+    trace_entry_t entry;
+    uint16_t entries = 0;
+    uint16_t dropped;
+    char line[40];
+    uint8_t line_length;
+
+    if (argc != 0) {
+        return MC_STATUS_BAD_ARGUMENT_COUNT;
+    }
+
+    if (!check_pointers(data, data_length)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // Read before streaming so the command's own output isn't affected by entries recorded meanwhile
+    dropped = trace_take_dropped();
+    while (trace_read(&entry)) {
+        line_length = snprintf(line, sizeof(line), "%08lX %08lX %08lX %04X %02X %02X\r\n",
+                               (unsigned long)entry.start_us, (unsigned long)entry.duration_us,
+                               (unsigned long)entry.value, entry.length, entry.event, entry.status);
+        mc_stream_data((uint8_t*)line, line_length);
+        entries++;
+    }
+
+    *data_length = snprintf((char*)data, MC_DATA_BUFFER_LENGTH, "ENTRIES %u\r\nDROPPED %u\r\n", entries, dropped);
+
+    return MC_STATUS_OK;
+}
+#endif
@@ -7,5 +7,8 @@ uint16_t mc_blobtest(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_l
 uint16_t mc_ping(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
 uint16_t mc_about(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
 uint16_t mc_list_commands(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+#ifdef MC_TRACE
+uint16_t mc_trace(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+#endif
 
 #endif
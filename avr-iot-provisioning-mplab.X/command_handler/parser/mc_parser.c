@@ -5,17 +5,29 @@
 #include "mc_parser.h"
 #include "mc_error.h"
 #include "mc_housekeeping.h"
+#include "mc_stats.h"
 #include "../mc_commands.h"
 #include "../mc_board.h"
+#include "../../mcc_generated_files/include/trace.h"
+#include "../../mcc_generated_files/include/counters.h"
 
 
 static void mc_return_string(const char *string);
 static void mc_print_lf( void );
 static uint8_t is_newline(char c);
+static void mc_parser_error(uint16_t status);
+static void mc_stats_phase_done(mc_stats_phase_t phase);
 
 static uint16_t mc_parse_command( void );
 static uint16_t mc_parse_arguments(char *argstring, uint8_t length);
 
+#ifdef MC_TRACE
+static void mc_trace_command(uint16_t status);
+#define MC_TRACE_COMMAND(status)    mc_trace_command(status)
+#else
+#define MC_TRACE_COMMAND(status)    ((void)0)
+#endif
+
 
 void (*put_char)(char) = NULL;
 
@@ -38,6 +50,14 @@ uint16_t linecounter;
 const mc_command_t *active_command;
 uint8_t  argcount;
 
+// Start of the command phase currently being timed for the latency statistics
+static uint32_t stats_phase_us;
+
+#ifdef MC_TRACE
+static uint32_t trace_command_us;
+static uint32_t trace_blob_us;
+#endif
+
 
 void mc_parser_init(void (*putc)(char))
 {
@@ -62,7 +82,7 @@ void mc_parser_init(void (*putc)(char))
 void mc_parser(char input)
 {
     if (linecounter >= MC_LINE_BUFFER_LENGTH) {
-        mc_print_status(MC_STATUS_BUFFER_OVERRUN);
+        mc_parser_error(MC_STATUS_BUFFER_OVERRUN);
         linecounter = 0;
         if (is_newline(input)) {
             parser_state = STATE_READY;
@@ -87,17 +107,21 @@ void mc_parser(char input)
         if (linecounter >= MC_LINE_BUFFER_LENGTH) {
             //overrun
             parser_state = STATE_ERR;
-            mc_print_status(MC_STATUS_BUFFER_OVERRUN);
+            mc_parser_error(MC_STATUS_BUFFER_OVERRUN);
             return;
         }
 
         linebuffer[linecounter++] = input;
 
         if (is_newline(input)) {
+            TRACE_MARK(trace_command_us);
             mc_print_lf();
+            // Cleared up front so a failed command is traced without a stale command or response length
+            active_command = NULL;
+            datalength = 0;
+            bool executed = false;
             uint16_t status = mc_parse_command();
             if (status== MC_STATUS_OK) {
-                datalength = 0;
                 if (active_command->data) {
                     if (argcount > 0) {
                         // Note using const to please XC8 which takes const 
@@ -108,38 +132,52 @@ void mc_parser(char input)
                         if (expected_datalength > MC_DATA_BUFFER_LENGTH) {
                             expected_datalength = MC_DATA_BUFFER_LENGTH;
 
-                            mc_print_status(MC_STATUS_BAD_BLOB);
+                            mc_parser_error(MC_STATUS_BAD_BLOB);
+                            MC_TRACE_COMMAND(MC_STATUS_BAD_BLOB);
                             parser_state = STATE_RESET;
                             return;
                         }
 
                         if (*endptr == '\0') {
                             mc_return_string(">");
+                            TRACE_MARK(trace_blob_us);
+                            stats_phase_us = mc_stats_time_us();
                             parser_state = STATE_DATA;
                             return;
 
                         } else {
-                            mc_print_status(MC_STATUS_BAD_BLOB);
+                            mc_parser_error(MC_STATUS_BAD_BLOB);
+                            MC_TRACE_COMMAND(MC_STATUS_BAD_BLOB);
                             parser_state = STATE_RESET;
                             return;
                         }
 
 
                     } else {
-                        mc_print_status(MC_STATUS_BAD_COMMAND);
+                        mc_parser_error(MC_STATUS_BAD_COMMAND);
+                        MC_TRACE_COMMAND(MC_STATUS_BAD_COMMAND);
                         parser_state = STATE_RESET;
                         return;
                     }
                 }
+                stats_phase_us = mc_stats_time_us();
                 status = active_command->command_function(argcount,argbuffer,databuffer,&datalength);
+                mc_stats_phase_done(MC_STATS_EXECUTE);
+                executed = true;
                 if (datalength && (put_char != NULL)) {
                     for (uint16_t i=0; i < datalength; i++) {
                         put_char(databuffer[i]);
                     }
                     mc_print_lf();
                 }
+            } else {
+                COUNTER_INC(parser_errors);
             }
             mc_print_status(status);
+            if (executed) {
+                mc_stats_phase_done(MC_STATS_RESPONSE);
+            }
+            MC_TRACE_COMMAND(status);
             parser_state = STATE_RESET;
 
             return;
@@ -159,8 +197,11 @@ void mc_parser(char input)
 
         } else if (is_newline(input)) {
             mc_print_lf();
+            TRACE_RECORD(TRACE_EVENT_BLOB, trace_blob_us, 0, datalength, 0);
+            mc_stats_phase_done(MC_STATS_BLOB);
 
             uint16_t status = active_command->command_function(argcount,argbuffer,databuffer,&datalength);
+            mc_stats_phase_done(MC_STATS_EXECUTE);
 
             if (datalength && (put_char != NULL)) {
                 for (uint16_t i=0; i < datalength; i++) {
@@ -169,11 +210,14 @@ void mc_parser(char input)
             }
             mc_print_lf();
             mc_print_status(status);
+            mc_stats_phase_done(MC_STATS_RESPONSE);
+            MC_TRACE_COMMAND(status);
             parser_state = STATE_RESET;
             return;
 
         } else {
-            mc_print_status(MC_STATUS_BAD_BLOB);
+            mc_parser_error(MC_STATUS_BAD_BLOB);
+            MC_TRACE_COMMAND(MC_STATUS_BAD_BLOB);
             parser_state = STATE_ERR;
         }
 
@@ -286,6 +330,22 @@ uint8_t mc_match_command(const char* partial, char* string, char** remainder)
 }
 
 
+/*
+ * Send data directly to the host while a command is executing.  Used by commands returning more data than fits in
+ * the data buffer.  Anything returned through the data buffer will follow after the streamed data
+ */
+void mc_stream_data(const uint8_t *data, uint16_t length)
+{
+    if (put_char == NULL) {
+        return;
+    }
+
+    for (uint16_t i = 0; i < length; i++) {
+        put_char(data[i]);
+    }
+}
+
+
 uint8_t mc_match_string(const char* match, const char* string)
 {
     uint8_t i = 0;
@@ -357,6 +417,30 @@ void mc_print_status(uint16_t status)
 
 
 
+/*
+ * Report an error detected by the parser itself, as opposed to errors returned by the commands
+ */
+static void mc_parser_error(uint16_t status)
+{
+    COUNTER_INC(parser_errors);
+    mc_print_status(status);
+}
+
+
+
+/*
+ * Record the duration of a phase of the active command and start timing the next one
+ */
+static void mc_stats_phase_done(mc_stats_phase_t phase)
+{
+    uint32_t now_us = mc_stats_time_us();
+
+    mc_stats_record(active_command - mc_command_set, phase, now_us - stats_phase_us);
+    stats_phase_us = now_us;
+}
+
+
+
 static uint8_t is_newline(char c)
 {
     if ((c == '\n') || (c == '\r')) {
@@ -365,3 +449,21 @@ static uint8_t is_newline(char c)
         return 0;
     }
 }
+
+
+#ifdef MC_TRACE
+/*
+ * Record the command that just completed, from its line being received until its status was sent
+ */
+static void mc_trace_command(uint16_t status)
+{
+    uint32_t index = 0xffff;
+
+    if (active_command != NULL) {
+        index = active_command - mc_command_set;
+    }
+
+    TRACE_RECORD(TRACE_EVENT_COMMAND, trace_command_us, (index << 16) | status, datalength,
+                 status ? TRACE_STATUS_FAIL : 0);
+}
+#endif
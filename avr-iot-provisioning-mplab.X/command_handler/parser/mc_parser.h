@@ -17,6 +17,7 @@ uint8_t mc_match_command(const char* partial, char* string, char** remainder);
 uint8_t mc_match_string(const char* match, const char* string);
 uint16_t mc_get_version (uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
 void mc_print_status(uint16_t status);
+void mc_stream_data(const uint8_t *data, uint16_t length);
 
 
 #endif /* __MC_PARSER_H__ */
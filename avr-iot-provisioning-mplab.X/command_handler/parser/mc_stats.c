@@ -0,0 +1,137 @@
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "mc_stats.h"
+#include "mc_parser.h"
+#include "mc_error.h"
+#include "../mc_commands.h"
+#include "../mc_argparser.h"
+#include "../../mcc_generated_files/include/tcb0.h"
+
+#define STATS_RESET ("RESET")
+#define STATS_NO_COMMAND 0xff
+
+typedef struct {
+    uint16_t buckets[MC_STATS_BUCKETS];
+    uint16_t max_ms;
+} mc_stats_histogram_t;
+
+typedef struct {
+    uint8_t command;
+    mc_stats_histogram_t phases[MC_STATS_PHASES];
+} mc_stats_entry_t;
+
+static const char * const phase_names[MC_STATS_PHASES] = {"BLOB", "EXECUTE", "RESPONSE"};
+
+// Slots are handed out to commands in the order they are first used, a host session only uses a handful of commands
+static mc_stats_entry_t stats[MC_STATS_COMMANDS];
+static uint8_t stats_used;
+
+static mc_stats_entry_t *find_entry(uint8_t command)
+{
+    uint8_t i;
+
+    for (i = 0; i < stats_used; i++) {
+        if (stats[i].command == command) {
+            return &stats[i];
+        }
+    }
+
+    if (stats_used == MC_STATS_COMMANDS) {
+        return NULL;
+    }
+
+    memset(&stats[stats_used], 0, sizeof(stats[stats_used]));
+    stats[stats_used].command = command;
+
+    return &stats[stats_used++];
+}
+
+uint32_t mc_stats_time_us(void)
+{
+    return TCB0_GetMicroseconds();
+}
+
+void mc_stats_record(uint8_t command, mc_stats_phase_t phase, uint32_t duration_us)
+{
+    mc_stats_entry_t *entry = find_entry(command);
+    mc_stats_histogram_t *histogram;
+    uint32_t ms = duration_us / 1000;
+    uint32_t limit_ms = 1;
+    uint8_t bucket = 0;
+
+    if (entry == NULL || phase >= MC_STATS_PHASES) {
+        return;
+    }
+    histogram = &entry->phases[phase];
+
+    while (bucket < (MC_STATS_BUCKETS - 1) && ms >= limit_ms) {
+        bucket++;
+        limit_ms <<= 2;
+    }
+
+    if (histogram->buckets[bucket] < UINT16_MAX) {
+        histogram->buckets[bucket]++;
+    }
+    if (ms > histogram->max_ms) {
+        histogram->max_ms = (ms < UINT16_MAX) ? ms : UINT16_MAX;
+    }
+}
+
+/*
+ * MC+STATS implementation, reports the latency histograms of the commands used since power-up or the last reset
+ *
+ * One line is streamed per command and phase with samples, on the format
+ * <command>,<phase>,<count 0>,...,<count 7>,<max ms> where the buckets are <1 ms, <4 ms, <16 ms, <64 ms, <256 ms,
+ * <1024 ms, <4096 ms and the rest.  The phases are BLOB (receiving the data line of data commands), EXECUTE and
+ * RESPONSE (queueing the returned data and status for the UART, which only waits when the transmit buffer is full,
+ * not for the last byte to be sent).
+ * MC+STATS=RESET clears the histograms after reporting them.
+ */
+uint16_t mc_stats(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length)
+{
+    char line[MC_LINE_BUFFER_LENGTH];
+    uint8_t length;
+    uint8_t i;
+    uint8_t phase;
+    uint8_t bucket;
+    const mc_stats_histogram_t *histogram;
+
+    if (argc > 1) {
+        return MC_STATUS_BAD_ARGUMENT_COUNT;
+    }
+
+    if (!check_pointers(data, data_length)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    if (argc == 1 && !mc_match_string(STATS_RESET, argv[0])) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // The report can be larger than the data buffer so it is streamed
+    for (i = 0; i < stats_used; i++) {
+        for (phase = 0; phase < MC_STATS_PHASES; phase++) {
+            histogram = &stats[i].phases[phase];
+            if (!histogram->max_ms && !histogram->buckets[0]) {
+                // Phase not used by this command, e.g. BLOB for commands without data
+                continue;
+            }
+            length = snprintf(line, sizeof(line), "%s,%s", mc_command_set[stats[i].command].command_string, phase_names[phase]);
+            for (bucket = 0; bucket < MC_STATS_BUCKETS; bucket++) {
+                length += snprintf(&line[length], sizeof(line) - length, ",%u", histogram->buckets[bucket]);
+            }
+            length += snprintf(&line[length], sizeof(line) - length, ",%u\r\n", histogram->max_ms);
+            mc_stream_data((uint8_t*)line, length);
+        }
+    }
+
+    *data_length = 0;
+
+    if (argc == 1) {
+        stats_used = 0;
+    }
+
+    return MC_STATUS_OK;
+}
@@ -0,0 +1,25 @@
+#ifndef __MC_STATS_H__
+#define __MC_STATS_H__
+#include <stdint.h>
+
+// Latency histograms per command, filled in by the parser around each command dispatch
+
+// Number of different commands histograms are kept for, commands beyond this are not recorded until MC+STATS=RESET
+#define MC_STATS_COMMANDS 8
+// Log-scale buckets, bucket 0 is below 1 ms and each following bucket is 4 times as wide as the previous one
+#define MC_STATS_BUCKETS  8
+
+typedef enum {
+    MC_STATS_BLOB = 0,      // From the data prompt until the data line has been received
+    MC_STATS_EXECUTE,       // Command function
+    MC_STATS_RESPONSE,      // From the command returning until the data and status are in the UART transmit
+                            // buffer.  The tail of the response may still be on its way to the host
+    MC_STATS_PHASES
+} mc_stats_phase_t;
+
+uint32_t mc_stats_time_us(void);
+void mc_stats_record(uint8_t command, mc_stats_phase_t phase, uint32_t duration_us);
+
+uint16_t mc_stats(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+
+#endif
@@ -28,7 +28,6 @@
 #include "command_handler/mc_argparser.h"
 #include "command_handler/parser/mc_error.h"
 
-#define DEVICE_PRIVATE_KEY_SLOT 0
 #define MAX_ECC_DATA_SLOT 15
 
 // Helpers
@@ -27,6 +27,9 @@
 extern "C" {
 #endif
 
+// Slot holding the device private key used for signing
+#define DEVICE_PRIVATE_KEY_SLOT 0
+
 enum ecc_read_args{
     ECC_READ_ARG_SLOT = 0,
     // The length argument is optional
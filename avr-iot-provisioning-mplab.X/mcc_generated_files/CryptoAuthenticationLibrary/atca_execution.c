@@ -38,6 +38,8 @@
 #include "atca_execution.h"
 #include "atca_devtypes.h"
 #include "hal/atca_hal.h"
+#include "../include/trace.h"
+#include "../include/counters.h"
 
 #ifndef ATCA_POLLING_INIT_TIME_MSEC
 #define ATCA_POLLING_INIT_TIME_MSEC       1
@@ -288,7 +290,9 @@ ATCA_STATUS atca_execute_command(ATCAPacket* packet, ATCADevice device)
     ATCA_STATUS status;
     uint32_t execution_or_wait_time;
     uint32_t max_delay_count;
-    uint16_t rxsize;
+    uint16_t rxsize = 0;
+    TRACE_START(u32CommandUs);
+    TRACE_START(u32PhaseUs);
 
     do
     {
@@ -304,20 +308,29 @@ ATCA_STATUS atca_execute_command(ATCAPacket* packet, ATCADevice device)
         max_delay_count = ATCA_POLLING_MAX_TIME_MSEC / ATCA_POLLING_FREQUENCY_TIME_MSEC;
 #endif
 
-        if ((status = atwake(device->mIface)) != ATCA_SUCCESS)
+        status = atwake(device->mIface);
+        TRACE_RECORD(TRACE_EVENT_ECC_WAKE, u32PhaseUs, packet->opcode, 0, status);
+        if (status != ATCA_SUCCESS)
         {
             break;
         }
 
         // send the command
-        if ((status = atsend(device->mIface, (uint8_t*)packet, packet->txsize)) != ATCA_SUCCESS)
+        TRACE_MARK(u32PhaseUs);
+        status = atsend(device->mIface, (uint8_t*)packet, packet->txsize);
+        TRACE_RECORD(TRACE_EVENT_ECC_SEND, u32PhaseUs, packet->opcode, packet->txsize, status);
+        if (status != ATCA_SUCCESS)
         {
             break;
         }
 
         // Delay for execution time or initial wait before polling
+        TRACE_MARK(u32PhaseUs);
         atca_delay_ms(execution_or_wait_time);
+        TRACE_RECORD(TRACE_EVENT_ECC_WAIT, u32PhaseUs, packet->opcode, execution_or_wait_time, 0);
 
+        // Polling delays are included in the receive phase
+        TRACE_MARK(u32PhaseUs);
         do
         {
             memset(packet->data, 0, sizeof(packet->data));
@@ -327,6 +340,7 @@ ATCA_STATUS atca_execute_command(ATCAPacket* packet, ATCADevice device)
             {
                 break;
             }
+            COUNTER_INC(ecc_retries);
 
 #ifndef ATCA_NO_POLL
             // delay for polling frequency time
@@ -334,6 +348,7 @@ ATCA_STATUS atca_execute_command(ATCAPacket* packet, ATCADevice device)
 #endif
         }
         while (max_delay_count-- > 0);
+        TRACE_RECORD(TRACE_EVENT_ECC_RECEIVE, u32PhaseUs, packet->opcode, rxsize, status);
         if (status != ATCA_SUCCESS)
         {
             break;
@@ -365,7 +380,10 @@ ATCA_STATUS atca_execute_command(ATCAPacket* packet, ATCADevice device)
     }
     while (0);
 
+    TRACE_MARK(u32PhaseUs);
     atidle(device->mIface);
+    TRACE_RECORD(TRACE_EVENT_ECC_IDLE, u32PhaseUs, packet->opcode, 0, 0);
+    TRACE_RECORD(TRACE_EVENT_ECC_COMMAND, u32CommandUs, packet->opcode, rxsize, status);
     return status;
 }
 
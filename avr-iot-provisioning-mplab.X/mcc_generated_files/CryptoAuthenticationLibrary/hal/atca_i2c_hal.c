@@ -30,6 +30,7 @@
 #include "../../drivers/i2c_simple_master.h"
 // Needed for ECC wake fix (see https://jira.microchip.com/browse/PAI-1099 and https://confluence.microchip.com/x/1YXDEg)
 #include "../../include/twi0_master.h"
+#include "../../include/counters.h"
 
 
 
@@ -118,6 +119,9 @@ ATCA_STATUS hal_i2c_wake(ATCAIface iface)
 	//uint8_t       zero_byte = 0;
     uint8_t       second_byte = 0xFF;
 
+    COUNTER_INC(ecc_wakes);
+    COUNTER_ADD(i2c_bytes, 1);
+
     // Manual fix for ECC wake issue,
     // see https://jira.microchip.com/browse/PAI-1099 and https://confluence.microchip.com/x/1YXDEg
 	// i2c_writeNBytes(i2c_address, &zero_byte, 1);
@@ -145,6 +149,7 @@ ATCA_STATUS hal_i2c_idle(ATCAIface iface)
 {
 	uint8_t data = 0x02;
 
+	COUNTER_INC(ecc_idles);
 	i2c_writeNBytes(i2c_address, &data, 1);
 
 	return ATCA_SUCCESS;
@@ -255,6 +260,8 @@ static twi0_error_t attempt_read(void){
  */
 ATCA_STATUS hal_ecc_sync(ATCAIface iface)
 {
+    COUNTER_INC(ecc_retries);
+
     // The I2C module does not support I2C bus software reset, so it must be
     // done manually
     // Close the bus
@@ -29,6 +29,7 @@
 
 #include "../include/twi0_master.h"
 #include "i2c_simple_master.h"
+#include "../include/counters.h"
 
 /****************************************************************/
 static twi0_operations_t wr1RegCompleteHandler(void *p)
@@ -70,6 +71,7 @@ void i2c_write1ByteRegister(twi0_address_t address, uint8_t reg, uint8_t data)
  */
 void i2c_writeNBytes(twi0_address_t address, void* data, size_t len)
 {
+    COUNTER_ADD(i2c_bytes, len);
     while(!I2C0_Open(address)); // sit here until we get the bus..
     I2C0_SetBuffer(data,len);
     I2C0_SetAddressNackCallback(I2C0_SetRestartWriteCallback,NULL); //NACK polling?
@@ -227,6 +229,7 @@ void i2c_readDataBlock(twi0_address_t address, uint8_t reg, void *data, size_t l
  */
 void i2c_readNBytes(twi0_address_t address, void *data, size_t len)
 {
+    COUNTER_ADD(i2c_bytes, len);
     while(!I2C0_Open(address)); // sit here until we get the bus..
     I2C0_SetBuffer(data,len);
     I2C0_MasterRead();
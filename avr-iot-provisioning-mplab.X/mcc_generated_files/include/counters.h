@@ -0,0 +1,90 @@
+/*
+    (c) 2021 Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip software and any
+    derivatives exclusively with Microchip products. It is your responsibility to comply with third party
+    license terms applicable to your use of third party software (including open source software) that
+    may accompany Microchip software.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY
+    IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS
+    FOR A PARTICULAR PURPOSE.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP
+    HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO
+    THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL
+    CLAIMS IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT
+    OF FEES, IF ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS
+    SOFTWARE.
+*/
+
+
+#ifndef COUNTERS_H_INCLUDED
+#define COUNTERS_H_INCLUDED
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Counters of hardware operations
+ *
+ * The counters are always enabled and are updated by the drivers where the operations take place, so the work done
+ * on the buses for a host command can be read out before and after it.  Counters wrap around, except the per sector
+ * erase counts which stop at 255.  Only counters updated from the main loop are kept here, counters updated from
+ * interrupts are kept by their driver (e.g. USART2_GetRxOverruns).
+ */
+
+/* Per sector erase counts are kept for the 1 MiB flash of the ATWINC1510, erases beyond it are only counted in total */
+#define COUNTERS_WINC_SECTORS       256
+#define COUNTERS_WINC_SECTOR_SIZE   4096UL
+
+typedef struct {
+    uint32_t spi_bytes;                 ///< Bytes transferred on the WINC SPI bus, in either direction
+    uint32_t winc_reg_reads;            ///< WINC register read transactions, including retries
+    uint32_t winc_reg_writes;           ///< WINC register write transactions, including retries
+    uint32_t winc_pages_programmed;     ///< WINC flash page program commands
+    uint32_t winc_sectors_erased;       ///< WINC flash sector erase commands
+    uint32_t i2c_bytes;                 ///< Data bytes transferred on the I2C bus, addresses not included
+    uint16_t ecc_wakes;                 ///< ECC wake sequences
+    uint16_t ecc_idles;                 ///< ECC idle commands
+    uint16_t ecc_retries;               ///< ECC response polls that had to be repeated and ECC resyncs
+    uint16_t parser_errors;             ///< Lines rejected by the command parser
+} counters_t;
+
+extern counters_t counters;
+
+#define COUNTER_ADD(name, n)    (counters.name += (n))
+#define COUNTER_INC(name)       COUNTER_ADD(name, 1)
+
+/**
+ * \brief Count a WINC flash sector erase
+ *
+ * \param[in] address   Flash address within the erased sector
+ */
+void counters_sector_erased(uint32_t address);
+
+/**
+ * \brief Get the number of times a WINC flash sector has been erased
+ *
+ * \param[in] sector    Sector number, less than COUNTERS_WINC_SECTORS
+ *
+ * \return Number of erases, saturated at 255
+ */
+uint8_t counters_get_sector_erases(uint16_t sector);
+
+/**
+ * \brief Set all counters to zero
+ */
+void counters_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COUNTERS_H_INCLUDED */
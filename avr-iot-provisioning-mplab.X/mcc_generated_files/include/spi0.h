@@ -135,6 +135,18 @@ bool SPI0_Open(spi0_configuration_t spiUniqueConfiguration);
 bool SPI0_OpenConfiguration(uint8_t spiUniqueConfiguration);
 
 
+/**
+ * \brief Change the SCK frequency of a configuration
+ *
+ * The new clock is used from the next time the configuration is opened.
+ *
+ * \param[in] spiUniqueConfiguration The configuration index
+ * \param[in] clock CTRLA prescaler and CLK2X bits, other bits are ignored
+ *
+ * \return Nothing
+ */
+void SPI0_SetConfigurationClock(uint8_t spiUniqueConfiguration, uint8_t clock);
+
 /**
  * \brief Close the SPI SPI0 for communication
  *
@@ -154,6 +166,9 @@ uint8_t SPI0_ExchangeByte(uint8_t data);
 /**
  * \brief Exchange a buffer over SPI SPI0. Blocks if using polled driver.
  *
+ * When the active configuration has BUFEN set the TX buffer is kept full
+ * while received bytes are drained, with no idle time between bytes.
+ *
  * \param[inout] block The buffer to transfer. Received data is returned here.
  * \param[in] size The size of buffer to transfer
  *
@@ -164,6 +179,9 @@ void SPI0_ExchangeBlock(void *block, size_t size);
 /**
  * \brief Write a buffer over SPI SPI0. Blocks if using polled driver.
  *
+ * With BUFEN set the next byte is queued while the previous one shifts out
+ * and received bytes are discarded; returns once the bus is idle.
+ *
  * \param[in] block The buffer to transfer
  * \param[in] size The size of buffer to transfer
  *
@@ -176,6 +194,8 @@ void SPI0_WriteBlock(void *block, size_t size);
  *
  * Zeros are transmitted out of the SPI.
  *
+ * With BUFEN set two dummy bytes are kept in flight at a time.
+ *
  * \param[out] block Received data is written here.
  * \param[in] size The size of buffer to transfer
  *
@@ -0,0 +1,71 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+    (c) 2018 Microchip Technology Inc. and its subsidiaries. 
+    
+    Subject to your compliance with these terms, you may use Microchip software and any 
+    derivatives exclusively with Microchip products. It is your responsibility to comply with third party 
+    license terms applicable to your use of third party software (including open source software) that 
+    may accompany Microchip software.
+    
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER 
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY 
+    IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS 
+    FOR A PARTICULAR PURPOSE.
+    
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP 
+    HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO 
+    THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL 
+    CLAIMS IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT 
+    OF FEES, IF ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS 
+    SOFTWARE.
+*/
+
+
+
+#ifndef TCB0_H_INCLUDED
+#define TCB0_H_INCLUDED
+
+#include <stdint.h>
+#include "../utils/compiler.h"
+#include "../config/clock_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* TCB0 runs in periodic interrupt mode with one compare match per millisecond */
+#define TCB0_TICKS_PER_US   (F_CPU / 1000000UL)
+#define TCB0_PERIOD         ((F_CPU / 1000UL) - 1)
+
+/**
+ * \brief Initialize TCB0 as a free running microsecond timebase
+ *
+ * \return Initialization status.
+ */
+int8_t TCB0_Initialize();
+
+/**
+ * \brief Get the time since TCB0 was initialized
+ *
+ * The value wraps after about 71 minutes, use unsigned subtraction to
+ * calculate durations.
+ *
+ * \return Time in microseconds
+ */
+uint32_t TCB0_GetMicroseconds(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TCB0_H_INCLUDED */
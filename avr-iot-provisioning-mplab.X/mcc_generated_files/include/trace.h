@@ -0,0 +1,149 @@
+/*
+    (c) 2021 Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip software and any
+    derivatives exclusively with Microchip products. It is your responsibility to comply with third party
+    license terms applicable to your use of third party software (including open source software) that
+    may accompany Microchip software.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY
+    IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS
+    FOR A PARTICULAR PURPOSE.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP
+    HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO
+    THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL
+    CLAIMS IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT
+    OF FEES, IF ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS
+    SOFTWARE.
+*/
+
+
+#ifndef TRACE_H_INCLUDED
+#define TRACE_H_INCLUDED
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Timeline of bus transactions and commands
+ *
+ * Tracing is compiled in only when MC_TRACE is defined (add it to the project's preprocessor macros).  Each
+ * traced operation is recorded with its start time (TCB0 microseconds), duration and size in a ring buffer,
+ * the oldest entries are overwritten when the buffer is full.  Without MC_TRACE the TRACE_* macros expand to
+ * nothing and cost neither time nor RAM.
+ */
+
+/* Number of entries kept, each takes 16 bytes of RAM */
+#ifndef TRACE_BUFFER_ENTRIES
+#define TRACE_BUFFER_ENTRIES    32
+#endif
+
+/* Status recorded for an operation that didn't complete successfully, unless a more specific code is known */
+#define TRACE_STATUS_FAIL       0xff
+
+typedef enum {
+    /* Command handler, value is the command table index << 16 | the 16 bit status returned to the host */
+    TRACE_EVENT_COMMAND = 1,        ///< Command line received until the status has been sent, length is response data length
+    TRACE_EVENT_BLOB,               ///< Data line received, length is the number of data characters
+
+    /* WINC bus, value is the register or memory address. Status is the number of retries after bus errors,
+       or TRACE_STATUS_FAIL */
+    TRACE_EVENT_WINC_INIT = 0x10,
+    TRACE_EVENT_WINC_RESET,
+    TRACE_EVENT_WINC_RECOVER,
+    TRACE_EVENT_WINC_READ_REG,
+    TRACE_EVENT_WINC_WRITE_REG,
+    TRACE_EVENT_WINC_WRITE_REG_SEQ, ///< Address of the first register, length is the number of registers
+    TRACE_EVENT_WINC_READ_BLOCK,    ///< Length is the number of bytes
+    TRACE_EVENT_WINC_WRITE_BLOCK,   ///< Length is the number of bytes
+
+    /* ECC command execution, value is the opcode, status is the ATCA_STATUS of the phase */
+    TRACE_EVENT_ECC_COMMAND = 0x20, ///< Whole command from wake to idle
+    TRACE_EVENT_ECC_WAKE,
+    TRACE_EVENT_ECC_SEND,           ///< Length is the number of bytes sent
+    TRACE_EVENT_ECC_WAIT,           ///< Initial execution or polling delay, length is the delay in ms
+    TRACE_EVENT_ECC_RECEIVE,        ///< Length is the number of bytes received
+    TRACE_EVENT_ECC_IDLE
+} trace_event_t;
+
+typedef struct {
+    uint32_t start_us;
+    uint32_t duration_us;
+    uint32_t value;
+    uint16_t length;
+    uint8_t  event;
+    uint8_t  status;
+} trace_entry_t;
+
+#ifdef MC_TRACE
+
+/* Declares a variable holding the start time of a traced operation, use at the end of a declaration list */
+#define TRACE_START(var)    uint32_t var = trace_time_us()
+/* Stores the current time in a variable declared elsewhere, e.g. when an operation spans several calls */
+#define TRACE_MARK(var)     ((var) = trace_time_us())
+/* Records an operation that started at start_us and ends now */
+#define TRACE_RECORD(event, start_us, value, length, status) \
+    trace_record((event), (start_us), (uint32_t)(value), (uint16_t)(length), (uint8_t)(status))
+
+#else
+
+#define TRACE_START(var)
+#define TRACE_MARK(var)     ((void)0)
+#define TRACE_RECORD(event, start_us, value, length, status) ((void)0)
+
+#endif
+
+/**
+ * \brief Get the time base used for trace entries
+ *
+ * \return Time in microseconds
+ */
+uint32_t trace_time_us(void);
+
+/**
+ * \brief Add an entry to the trace buffer
+ *
+ * Overwrites the oldest entry if the buffer is full.
+ *
+ * \param[in] event     Type of operation, see trace_event_t
+ * \param[in] start_us  Time the operation started, from trace_time_us
+ * \param[in] value     Event specific value
+ * \param[in] length    Number of bytes or items
+ * \param[in] status    Event specific status, 0 for success
+ */
+void trace_record(uint8_t event, uint32_t start_us, uint32_t value, uint16_t length, uint8_t status);
+
+/**
+ * \brief Remove the oldest entry from the trace buffer
+ *
+ * \param[out] entry    The entry
+ *
+ * \return true if an entry was returned, false if the buffer is empty
+ */
+bool trace_read(trace_entry_t *entry);
+
+/**
+ * \brief Get and clear the number of entries overwritten before they were read
+ *
+ * \return Number of entries lost since the last call
+ */
+uint16_t trace_take_dropped(void);
+
+/**
+ * \brief Empty the trace buffer
+ */
+void trace_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_H_INCLUDED */
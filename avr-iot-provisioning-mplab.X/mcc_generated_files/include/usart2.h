@@ -150,6 +150,22 @@ bool USART2_IsTxDone();
  */
 uint8_t USART2_Read(void);
 
+/**
+ * \brief Get the number of received characters lost since the last clear
+ *
+ * Counts characters lost both because the receive buffer was full and because the USART wasn't read in time.
+ *
+ * \return Number of lost characters
+ */
+uint16_t USART2_GetRxOverruns(void);
+
+/**
+ * \brief Clear the count of lost received characters
+ *
+ * \return Nothing
+ */
+void USART2_ClearRxOverruns(void);
+
 /**
  * \brief Write one character to USART2
  *
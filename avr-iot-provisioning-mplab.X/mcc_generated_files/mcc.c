@@ -45,6 +45,7 @@ void SYSTEM_Initialize(void)
     CLKCTRL_Initialize();
     I2C0_Initialize();
     SPI0_Initialize();
+    TCB0_Initialize();
     USART2_Initialize();
     CPUINT_Initialize();
     CryptoAuth_Initialize();
@@ -48,6 +48,7 @@ extern "C" {
 #include "CryptoAuth_init.h"
 #include "include/cpuint.h"
 #include "include/spi0.h"
+#include "include/tcb0.h"
 #include "config/clock_config.h"
 
 /**
@@ -0,0 +1,57 @@
+/*
+    (c) 2021 Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip software and any
+    derivatives exclusively with Microchip products. It is your responsibility to comply with third party
+    license terms applicable to your use of third party software (including open source software) that
+    may accompany Microchip software.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY
+    IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS
+    FOR A PARTICULAR PURPOSE.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP
+    HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO
+    THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL
+    CLAIMS IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT
+    OF FEES, IF ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS
+    SOFTWARE.
+*/
+
+
+#include <string.h>
+#include "../include/counters.h"
+
+counters_t counters;
+
+// One byte per sector, enough to spot the sectors that are rewritten on every provisioning run
+static uint8_t sector_erases[COUNTERS_WINC_SECTORS];
+
+void counters_sector_erased(uint32_t address)
+{
+    uint32_t sector = address / COUNTERS_WINC_SECTOR_SIZE;
+
+    COUNTER_INC(winc_sectors_erased);
+
+    if (sector < COUNTERS_WINC_SECTORS && sector_erases[sector] < UINT8_MAX) {
+        sector_erases[sector]++;
+    }
+}
+
+uint8_t counters_get_sector_erases(uint16_t sector)
+{
+    if (sector >= COUNTERS_WINC_SECTORS) {
+        return 0;
+    }
+
+    return sector_erases[sector];
+}
+
+void counters_clear(void)
+{
+    memset(&counters, 0, sizeof(counters));
+    memset(sector_erases, 0, sizeof(sector_erases));
+}
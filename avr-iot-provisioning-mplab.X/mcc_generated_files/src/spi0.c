@@ -39,7 +39,7 @@ typedef struct spi0_descriptor_s {
 } spi0_descriptor_t;
 
 spi0_configuration_t spi0_configurations[] = {
-    { 0x23, 0x0 },
+    { 0x23, 0xc0 },
     { 0x31, 0x0 }
 };
 
@@ -90,6 +90,13 @@ bool SPI0_Open(spi0_configuration_t spiUniqueConfiguration)
     }
 }
 
+void SPI0_SetConfigurationClock(uint8_t spiUniqueConfiguration, uint8_t clock)
+{
+    uint8_t ctrla = spi0_configurations[spiUniqueConfiguration].CTRLAvalue;
+    ctrla &= ~(SPI_PRESC_gm | SPI_CLK2X_bm);
+    spi0_configurations[spiUniqueConfiguration].CTRLAvalue = ctrla | (clock & (SPI_PRESC_gm | SPI_CLK2X_bm));
+}
+
 void SPI0_Close(void)
 {
     spi0_desc.status = SPI0_FREE;
@@ -127,9 +134,46 @@ void SPI0_WaitDataready()
         ;
 }
 
+// In buffered mode the SPI holds one byte in the TX buffer and one in the
+// shift register, and queues up to two received bytes. Keeping at most two
+// bytes in flight lets the TX side run ahead without ever overflowing RX.
+#define SPI0_BUFFERED_IN_FLIGHT 2
+
+static inline bool spi0_buffered(void)
+{
+    return (SPI0.CTRLB & SPI_BUFEN_bm) != 0;
+}
+
+// Waits for the last byte to leave the shift register and discards anything
+// still queued in the RX buffer, so nCS can be released straight after.
+static void spi0_buffered_finish(void)
+{
+    while (!(SPI0.INTFLAGS & SPI_TXCIF_bm))
+        ;
+    while (SPI0.INTFLAGS & SPI_RXCIF_bm) {
+        (void)SPI0.DATA;
+    }
+    SPI0.INTFLAGS = SPI_TXCIF_bm | SPI_BUFOVF_bm;
+}
+
 void SPI0_ExchangeBlock(void *block, size_t size)
 {
     uint8_t *b = (uint8_t *)block;
+    if (spi0_buffered()) {
+        uint8_t *rx = b;
+        size_t   pending = size;
+        while (pending) {
+            if (size && (pending - size) < SPI0_BUFFERED_IN_FLIGHT && (SPI0.INTFLAGS & SPI_DREIF_bm)) {
+                SPI0.DATA = *b++;
+                size--;
+            }
+            if (SPI0.INTFLAGS & SPI_RXCIF_bm) {
+                *rx++ = SPI0.DATA;
+                pending--;
+            }
+        }
+        return;
+    }
     while (size--) {
         SPI0.DATA = *b;
         while (!(SPI0.INTFLAGS & SPI_RXCIF_bm))
@@ -143,6 +187,22 @@ void SPI0_WriteBlock(void *block, size_t size)
 {
     uint8_t *b = (uint8_t *)block;
     uint8_t  rdata;
+    if (spi0_buffered()) {
+        // Received bytes are of no interest; they are only drained so the
+        // RX buffer does not flag an overflow.
+        SPI0.INTFLAGS = SPI_TXCIF_bm;
+        while (size) {
+            if (SPI0.INTFLAGS & SPI_DREIF_bm) {
+                SPI0.DATA = *b++;
+                size--;
+            }
+            if (SPI0.INTFLAGS & SPI_RXCIF_bm) {
+                rdata = SPI0.DATA;
+            }
+        }
+        spi0_buffered_finish();
+        return;
+    }
     while (size--) {
         SPI0.DATA = *b;
         while (!(SPI0.INTFLAGS & SPI_RXCIF_bm))
@@ -156,6 +216,22 @@ void SPI0_WriteBlock(void *block, size_t size)
 void SPI0_ReadBlock(void *block, size_t size)
 {
     uint8_t *b = (uint8_t *)block;
+    if (spi0_buffered()) {
+        // Only dummy zeros go out, so the TX side just counts bytes
+        size_t sent = 0;
+        while (size) {
+            if (sent < SPI0_BUFFERED_IN_FLIGHT && sent < size && (SPI0.INTFLAGS & SPI_DREIF_bm)) {
+                SPI0.DATA = 0;
+                sent++;
+            }
+            if (SPI0.INTFLAGS & SPI_RXCIF_bm) {
+                *b++ = SPI0.DATA;
+                sent--;
+                size--;
+            }
+        }
+        return;
+    }
     while (size--) {
         SPI0.DATA = 0;
         while (!(SPI0.INTFLAGS & SPI_RXCIF_bm))
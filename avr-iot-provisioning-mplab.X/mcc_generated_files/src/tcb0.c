@@ -0,0 +1,89 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+    (c) 2018 Microchip Technology Inc. and its subsidiaries. 
+    
+    Subject to your compliance with these terms, you may use Microchip software and any 
+    derivatives exclusively with Microchip products. It is your responsibility to comply with third party 
+    license terms applicable to your use of third party software (including open source software) that 
+    may accompany Microchip software.
+    
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER 
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY 
+    IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS 
+    FOR A PARTICULAR PURPOSE.
+    
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP 
+    HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO 
+    THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL 
+    CLAIMS IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT 
+    OF FEES, IF ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS 
+    SOFTWARE.
+*/
+
+
+
+#include "../include/tcb0.h"
+#include "../utils/atomic.h"
+
+static volatile uint32_t tcb0_milliseconds;
+
+/**
+ * \brief Initialize tcb0 interface
+ */
+int8_t TCB0_Initialize()
+{
+    tcb0_milliseconds = 0;
+
+    //Compare or Capture
+    TCB0.CCMP = TCB0_PERIOD;
+
+    //Count
+    TCB0.CNT = 0x00;
+
+    //CNTMODE INT; CCMPEN disabled; CCMPINIT disabled; ASYNC disabled; 
+    TCB0.CTRLB = TCB_CNTMODE_INT_gc;
+
+    //CAPT enabled; 
+    TCB0.INTCTRL = TCB_CAPT_bm;
+
+    //RUNSTDBY disabled; SYNCUPD disabled; CLKSEL CLKDIV1; ENABLE enabled; 
+    TCB0.CTRLA = TCB_CLKSEL_CLKDIV1_gc | TCB_ENABLE_bm;
+
+    return 0;
+}
+
+ISR(TCB0_INT_vect)
+{
+    tcb0_milliseconds++;
+
+    /* The interrupt flag has to be cleared manually */
+    TCB0.INTFLAGS = TCB_CAPT_bm;
+}
+
+uint32_t TCB0_GetMicroseconds(void)
+{
+    uint32_t milliseconds;
+    uint16_t count;
+
+    ENTER_CRITICAL(T);
+    milliseconds = tcb0_milliseconds;
+    count = TCB0.CNT;
+    if (TCB0.INTFLAGS & TCB_CAPT_bm) {
+        // The counter wrapped after interrupts were disabled, count the pending tick here
+        count = TCB0.CNT;
+        milliseconds++;
+    }
+    EXIT_CRITICAL(T);
+
+    return (milliseconds * 1000UL) + (count / TCB0_TICKS_PER_US);
+}
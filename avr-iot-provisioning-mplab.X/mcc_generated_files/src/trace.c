@@ -0,0 +1,104 @@
+/*
+    (c) 2021 Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip software and any
+    derivatives exclusively with Microchip products. It is your responsibility to comply with third party
+    license terms applicable to your use of third party software (including open source software) that
+    may accompany Microchip software.
+
+    THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+    EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY
+    IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS
+    FOR A PARTICULAR PURPOSE.
+
+    IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+    WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP
+    HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO
+    THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL
+    CLAIMS IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT
+    OF FEES, IF ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS
+    SOFTWARE.
+*/
+
+
+#include "../include/trace.h"
+
+#ifdef MC_TRACE
+
+#include "../include/tcb0.h"
+
+/* Entries are only recorded from the main loop, never from interrupts, so no locking is needed */
+static trace_entry_t trace_buffer[TRACE_BUFFER_ENTRIES];
+static uint8_t trace_head;
+static uint8_t trace_count;
+static uint16_t trace_dropped;
+
+uint32_t trace_time_us(void)
+{
+    return TCB0_GetMicroseconds();
+}
+
+void trace_record(uint8_t event, uint32_t start_us, uint32_t value, uint16_t length, uint8_t status)
+{
+    trace_entry_t *entry;
+    uint8_t index;
+
+    index = trace_head + trace_count;
+    if (index >= TRACE_BUFFER_ENTRIES) {
+        index -= TRACE_BUFFER_ENTRIES;
+    }
+
+    if (trace_count == TRACE_BUFFER_ENTRIES) {
+        // Full, the oldest entry makes room
+        if (++trace_head == TRACE_BUFFER_ENTRIES) {
+            trace_head = 0;
+        }
+        if (trace_dropped < UINT16_MAX) {
+            trace_dropped++;
+        }
+    } else {
+        trace_count++;
+    }
+
+    entry = &trace_buffer[index];
+    entry->start_us = start_us;
+    entry->duration_us = trace_time_us() - start_us;
+    entry->value = value;
+    entry->length = length;
+    entry->event = event;
+    entry->status = status;
+}
+
+bool trace_read(trace_entry_t *entry)
+{
+    if (!trace_count) {
+        return false;
+    }
+
+    *entry = trace_buffer[trace_head];
+    if (++trace_head == TRACE_BUFFER_ENTRIES) {
+        trace_head = 0;
+    }
+    trace_count--;
+
+    return true;
+}
+
+uint16_t trace_take_dropped(void)
+{
+    uint16_t dropped = trace_dropped;
+
+    trace_dropped = 0;
+
+    return dropped;
+}
+
+void trace_clear(void)
+{
+    trace_head = 0;
+    trace_count = 0;
+    trace_dropped = 0;
+}
+
+#endif /* MC_TRACE */
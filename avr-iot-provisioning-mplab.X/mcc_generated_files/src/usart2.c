@@ -43,6 +43,7 @@ static uint8_t          USART2_txbuf[USART2_TX_BUFFER_SIZE];
 static volatile uint8_t USART2_tx_head;
 static volatile uint8_t USART2_tx_tail;
 static volatile uint8_t USART2_tx_elements;
+static volatile uint16_t USART2_rx_overruns;
 
 void (*USART2_rx_isr_cb)(void) = &USART2_DefaultRxIsrCb;
 
@@ -53,6 +54,11 @@ void USART2_DefaultRxIsrCb(void)
     uint8_t data;
     uint8_t tmphead;
 
+    /* Characters lost in the USART itself, must be checked before RXDATAL is read */
+    if (USART2.RXDATAH & USART_BUFOVF_bm) {
+        USART2_rx_overruns++;
+    }
+
     /* Read the received data */
     data = USART2.RXDATAL;
     /* Calculate buffer index */
@@ -60,6 +66,7 @@ void USART2_DefaultRxIsrCb(void)
         
     if (tmphead == USART2_rx_tail) {
             /* ERROR! Receive buffer overflow */
+            USART2_rx_overruns++;
     }else {
     /*Store new index*/
     USART2_rx_head = tmphead;
@@ -179,6 +186,24 @@ uint8_t USART2_Read(void)
     return USART2_rxbuf[tmptail];
 }
 
+uint16_t USART2_GetRxOverruns(void)
+{
+    uint16_t overruns;
+
+    ENTER_CRITICAL(R);
+    overruns = USART2_rx_overruns;
+    EXIT_CRITICAL(R);
+
+    return overruns;
+}
+
+void USART2_ClearRxOverruns(void)
+{
+    ENTER_CRITICAL(R);
+    USART2_rx_overruns = 0;
+    EXIT_CRITICAL(R);
+}
+
 void USART2_Write(const uint8_t data)
 {
     uint8_t tmphead;
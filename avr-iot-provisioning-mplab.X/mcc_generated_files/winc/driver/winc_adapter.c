@@ -38,9 +38,25 @@
 #include "../../mcc.h"
 #include "../../delay.h"
 #include "winc_adapter.h"
+#include "../../include/counters.h"
 
 static int_fast8_t serviceRequest;
 
+/* SPI0 clock settings for the WINC, from the power-up default upwards */
+static const struct
+{
+    uint8_t u8Clock;
+    uint8_t u8Divider;
+} gastrSpiClocks[WINC_ADAPTER_SPI_CLOCK_COUNT] =
+{
+    {SPI_PRESC_DIV16_gc, 16},
+    {SPI_PRESC_DIV16_gc | SPI_CLK2X_bm, 8},
+    {SPI_PRESC_DIV4_gc, 4},
+    {SPI_PRESC_DIV4_gc | SPI_CLK2X_bm, 2}
+};
+
+static uint_fast8_t gu8SpiClock = WINC_ADAPTER_SPI_CLOCK_SAFE;
+
 static void winc_interrupt_handler(void)
 {
     if (!(INT_GetValue()))
@@ -94,6 +110,17 @@ void winc_adapter_sleep(uint32_t u32TimeMsec)
     }
 }
 
+uint32_t winc_adapter_time_us(void)
+{
+    return TCB0_GetMicroseconds();
+}
+
+void winc_adapter_delay_us(uint32_t u32TimeUsec)
+{
+    winc_adapter_sleep(u32TimeUsec / 1000);
+    DELAY_microseconds(u32TimeUsec % 1000);
+}
+
 void winc_adapter_chip_enable_assert(void)
 {
     CE_SetHigh();
@@ -123,6 +150,8 @@ int_fast8_t winc_adapter_spi_write(const uint8_t *puBuf, size_t size)
 {
     if (puBuf == NULL)
         return 0;
+
+    COUNTER_ADD(spi_bytes, size);
     
     spiMaster[WINC].spiOpen();
     nCS_SetLow();
@@ -145,6 +174,8 @@ int_fast8_t winc_adapter_spi_read(uint8_t *puBuf, size_t size)
 { 
    if (puBuf == NULL)
         return 0;
+
+    COUNTER_ADD(spi_bytes, size);
     
     spiMaster[WINC].spiOpen();
     nCS_SetLow();
@@ -163,6 +194,22 @@ int_fast8_t winc_adapter_spi_read(uint8_t *puBuf, size_t size)
     return 1;
 }
 
+int_fast8_t winc_adapter_spi_set_clock(uint_fast8_t u8Clock)
+{
+    if (u8Clock >= WINC_ADAPTER_SPI_CLOCK_COUNT)
+        return 0;
+
+    SPI0_SetConfigurationClock(WINC_CONFIG, gastrSpiClocks[u8Clock].u8Clock);
+    gu8SpiClock = u8Clock;
+
+    return 1;
+}
+
+uint32_t winc_adapter_spi_get_clock_hz(void)
+{
+    return F_CPU / gastrSpiClocks[gu8SpiClock].u8Divider;
+}
+
 int_fast8_t winc_adapter_spi_close(void)
 {
     return 1;
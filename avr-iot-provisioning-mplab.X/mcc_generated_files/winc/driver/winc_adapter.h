@@ -79,6 +79,10 @@
 
 #define WINC_TO_HOST_U32            HOST_TO_WINC_U32
 #define WINC_TO_HOST_U16            HOST_TO_WINC_U16
+
+/* SPI clock settings selectable with winc_adapter_spi_set_clock, higher is faster */
+#define WINC_ADAPTER_SPI_CLOCK_SAFE     0
+#define WINC_ADAPTER_SPI_CLOCK_COUNT    4
 /**@}*/     // ADAPTERDefine
 
 #ifdef __cplusplus
@@ -172,6 +176,38 @@ int_fast8_t winc_adapter_deinit(void);
 */
 void winc_adapter_sleep(uint32_t u32TimeMsec);
 
+/*!
+@fn \
+    void winc_adapter_delay_us(uint32_t u32TimeUsec);
+
+@brief
+    Used to busy wait for the specified duration (in microseconds), for example between
+    polls of a WINC status register.
+
+@param[in]  u32TimeUsec
+    Time unit in microseconds.
+
+@note
+    Implementation of this function is host dependent.
+*/
+void winc_adapter_delay_us(uint32_t u32TimeUsec);
+
+/*!
+@fn \
+    uint32_t winc_adapter_time_us(void);
+
+@brief
+    Returns a free running time in microseconds, used to measure and bound WINC operations.
+
+@note
+    Implementation of this function is host dependent. The value is allowed to wrap, the
+    driver only uses the difference between two readings.
+
+@return
+    Current time in microseconds.
+*/
+uint32_t winc_adapter_time_us(void);
+
 /**@}*/     // ADAPTERSleep
 /**@addtogroup ADAPTERInt
  * @{
@@ -275,6 +311,43 @@ int_fast8_t winc_adapter_spi_open(void);
 */
 int_fast8_t winc_adapter_spi_close(void);
 
+/*!
+@fn \
+    int_fast8_t winc_adapter_spi_set_clock(uint_fast8_t u8Clock);
+
+@brief
+    Select the SPI clock used for the following transfers.
+
+@param[in]  u8Clock
+    Clock setting, from @ref WINC_ADAPTER_SPI_CLOCK_SAFE (the power-up default) up to
+    @ref WINC_ADAPTER_SPI_CLOCK_COUNT - 1 (the fastest the host supports).
+
+@note
+    Implementation of this function is host dependent. Faster settings are not guaranteed to
+    work on every board, the link should be checked after changing the clock.
+
+@see    winc_adapter_spi_get_clock_hz
+
+@return
+    The function returns a value of 1 for successful operations and a 0 value otherwise.
+*/
+int_fast8_t winc_adapter_spi_set_clock(uint_fast8_t u8Clock);
+
+/*!
+@fn \
+    uint32_t winc_adapter_spi_get_clock_hz(void);
+
+@brief
+    Returns the frequency of the SPI clock currently selected.
+
+@note
+    Implementation of this function is host dependent.
+
+@return
+    SPI clock frequency in Hz.
+*/
+uint32_t winc_adapter_spi_get_clock_hz(void);
+
 /*!
 @fn \
     int_fast8_t winc_adapter_spi_write(const uint8_t *puBuf, size_t size);
@@ -43,6 +43,7 @@
 #include "winc_asic.h"
 #include "winc_spi.h"
 #include "../spi_flash/spi_flash.h"
+#include "../spi_flash/flexible_flash.h"
 
 int_fast8_t winc_drv_init(bool bHold)
 {
@@ -64,6 +65,12 @@ int_fast8_t winc_drv_init(bool bHold)
     if (WINC_BUS_SUCCESS != winc_bus_init())
         return WINC_DRV_FAIL;
 
+    /* The firmware may have updated the flash map while it was running */
+    spi_flexible_flash_invalidate_all();
+    /* and the shared memory holding any read ahead or staged page is gone.
+       Callers that may reset the WINC with flash work pending check for it first */
+    spi_flash_reset_pipeline();
+
     WINC_LOG_INFO("Chip ID %" PRIx32, winc_chip_get_id());
 
     if (bHold)
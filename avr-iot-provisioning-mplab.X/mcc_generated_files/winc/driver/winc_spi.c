@@ -39,6 +39,8 @@
 #include "../common/winc_registers.h"
 #include "winc_adapter.h"
 #include "winc_spi.h"
+#include "../../include/trace.h"
+#include "../../include/counters.h"
 
 #define CMD_INTERNAL_WRITE      0xc3
 #define CMD_INTERNAL_READ       0xc4
@@ -49,6 +51,7 @@
 #define CMD_RESET               0xcf
 
 #define SPI_RESP_RETRY_COUNT    (10)
+#define SPI_RETRY_COUNT         (3)
 #define DATA_PKT_SZ             (8*1024)
 
 static bool bSPIBusError = true;
@@ -227,6 +230,8 @@ static int_fast8_t spi_read_reg(uint32_t u32Addr, uint32_t *pu32RetVal)
 
     WINC_ASSERT(pu32RetVal != NULL);
 
+    COUNTER_INC(winc_reg_reads);
+
     if (u32Addr <= 0xff)
     {
         // Read is from clockless registers so setup command for internal read
@@ -284,6 +289,8 @@ static int_fast8_t spi_write_reg(const uint32_t u32Addr, const uint32_t u32Val,
     uint8_t u8CmdBuf[8];
     uint8_t *pu8CmdBuf = u8CmdBuf;
 
+    COUNTER_INC(winc_reg_writes);
+
     if (u32Addr <= 0x30)
     {
         // Write is to clockless registers so setup command for internal write
@@ -341,8 +348,42 @@ static int_fast8_t spi_write_reg(const uint32_t u32Addr, const uint32_t u32Val,
     return WINC_BUS_SUCCESS;
 }
 
+static int_fast8_t spi_reset(void)
+{
+    static const uint8_t u8CmdBuf[5] = {CMD_RESET, 0xff, 0xff, 0xff, 0x00/*, 0xaa*/};
+
+    // Send command to reset SPI
+    return spi_cmd_send(u8CmdBuf, 5);
+}
+
+static int_fast8_t spi_recover(void)
+{
+    uint32_t u32ChipId;
+
+    // A glitch mid-transfer leaves the WINC SPI state machine out of step
+    // with the host, reset it and give it time to settle before retrying
+    if (WINC_BUS_SUCCESS != spi_reset())
+        return WINC_BUS_FAIL;
+
+    winc_adapter_sleep(1);
+
+    // The chip ID confirms the WINC is responding and hasn't been reset,
+    // otherwise retrying is pointless as the WINC state has been lost
+    if (WINC_BUS_SUCCESS != spi_read_reg(NMI_CHIPID, &u32ChipId))
+        return WINC_BUS_FAIL;
+
+    if ((u32ChipId == 0) || (u32ChipId == 0xffffffff))
+        return WINC_BUS_FAIL;
+
+    WINC_LOG_INFO("SPI bus recovered");
+
+    return WINC_BUS_SUCCESS;
+}
+
 int_fast8_t winc_bus_write_reg(const uint32_t u32Addr, const uint32_t u32Val)
 {
+    TRACE_START(u32TraceUs);
+
     // External API: Don't run if bus error is present, preset error so only
     // successful path leads to clearing the error condition
     WINC_CRIT_SEC_BUS_ENTER;
@@ -356,17 +397,21 @@ int_fast8_t winc_bus_write_reg(const uint32_t u32Addr, const uint32_t u32Val)
     if (WINC_BUS_SUCCESS != spi_write_reg(u32Addr, u32Val, 1))
     {
         WINC_ASSERT(0);
+        TRACE_RECORD(TRACE_EVENT_WINC_WRITE_REG, u32TraceUs, u32Addr, 4, TRACE_STATUS_FAIL);
         return WINC_BUS_FAIL;
     }
     
     // Clear bus error condition as operation was successful
     bSPIBusError = false;
+    TRACE_RECORD(TRACE_EVENT_WINC_WRITE_REG, u32TraceUs, u32Addr, 4, 0);
     WINC_CRIT_SEC_BUS_LEAVE;
     return WINC_BUS_SUCCESS;
 }
 
 int_fast8_t winc_bus_write_reg_no_rsp(const uint32_t u32Addr, const uint32_t u32Val)
 {
+    TRACE_START(u32TraceUs);
+
     // External API: Don't run if bus error is present, preset error so only
     // successful path leads to clearing the error condition
     WINC_CRIT_SEC_BUS_ENTER;
@@ -380,21 +425,21 @@ int_fast8_t winc_bus_write_reg_no_rsp(const uint32_t u32Addr, const uint32_t u32
     if (WINC_BUS_SUCCESS != spi_write_reg(u32Addr, u32Val, 0))
     {
         WINC_ASSERT(0);
+        TRACE_RECORD(TRACE_EVENT_WINC_WRITE_REG, u32TraceUs, u32Addr, 4, TRACE_STATUS_FAIL);
         return WINC_BUS_FAIL;
     }
 
     // Clear bus error condition as operation was successful
     bSPIBusError = false;
+    TRACE_RECORD(TRACE_EVENT_WINC_WRITE_REG, u32TraceUs, u32Addr, 4, 0);
     WINC_CRIT_SEC_BUS_LEAVE;
     return WINC_BUS_SUCCESS;
 }
 
-int_fast8_t winc_bus_write_block(uint32_t u32Addr, const uint8_t *pu8Buf, uint_fast16_t u16Sz)
+int_fast8_t winc_bus_write_reg_seq(const tstrWincBusRegWrite *pstrRegs, uint_fast8_t u8Count)
 {
-    uint8_t u8CmdBuf[7] = {CMD_DMA_EXT_WRITE};
-
-    WINC_ASSERT(pu8Buf != NULL);
-    WINC_ASSERT(u16Sz > 0);
+    uint_fast8_t i;
+    TRACE_START(u32TraceUs);
 
     // External API: Don't run if bus error is present, preset error so only
     // successful path leads to clearing the error condition
@@ -404,8 +449,45 @@ int_fast8_t winc_bus_write_block(uint32_t u32Addr, const uint8_t *pu8Buf, uint_f
         WINC_ASSERT(0);
         return WINC_BUS_FAIL;
     }
+
+    if (!u8Count)
+    {
+        WINC_CRIT_SEC_BUS_LEAVE;
+        return WINC_BUS_SUCCESS;
+    }
+
     bSPIBusError = true;
 
+    // Push all but the last register without waiting for a response, the
+    // response to the final write confirms the WINC accepted the sequence
+    for (i = 0; i < (u8Count - 1); i++)
+    {
+        if (WINC_BUS_SUCCESS != spi_write_reg(pstrRegs[i].u32Addr, pstrRegs[i].u32Val, 0))
+        {
+            WINC_ASSERT(0);
+            TRACE_RECORD(TRACE_EVENT_WINC_WRITE_REG_SEQ, u32TraceUs, pstrRegs[0].u32Addr, u8Count, TRACE_STATUS_FAIL);
+            return WINC_BUS_FAIL;
+        }
+    }
+
+    if (WINC_BUS_SUCCESS != spi_write_reg(pstrRegs[i].u32Addr, pstrRegs[i].u32Val, 1))
+    {
+        WINC_ASSERT(0);
+        TRACE_RECORD(TRACE_EVENT_WINC_WRITE_REG_SEQ, u32TraceUs, pstrRegs[0].u32Addr, u8Count, TRACE_STATUS_FAIL);
+        return WINC_BUS_FAIL;
+    }
+
+    // Clear bus error condition as operation was successful
+    bSPIBusError = false;
+    TRACE_RECORD(TRACE_EVENT_WINC_WRITE_REG_SEQ, u32TraceUs, pstrRegs[0].u32Addr, u8Count, 0);
+    WINC_CRIT_SEC_BUS_LEAVE;
+    return WINC_BUS_SUCCESS;
+}
+
+static int_fast8_t spi_write_block(uint32_t u32Addr, const uint8_t *pu8Buf, uint_fast16_t u16Sz)
+{
+    uint8_t u8CmdBuf[7] = {CMD_DMA_EXT_WRITE};
+
     //Workaround hardware problem with single byte transfers over SPI bus
     if (u16Sz == 1)
         u16Sz = 2;
@@ -442,17 +524,13 @@ int_fast8_t winc_bus_write_block(uint32_t u32Addr, const uint8_t *pu8Buf, uint_f
         return WINC_BUS_FAIL;
     }
 
-    // Clear bus error condition as operation was successful
-    bSPIBusError = false;
-    WINC_CRIT_SEC_BUS_LEAVE;
     return WINC_BUS_SUCCESS;
 }
 
-int_fast8_t winc_bus_read_block(const uint32_t u32Addr, uint8_t *pu8Buf, uint_fast16_t u16Sz)
+int_fast8_t winc_bus_write_block(uint32_t u32Addr, const uint8_t *pu8Buf, uint_fast16_t u16Sz)
 {
-    int_fast8_t i8Result;
-    uint8_t u8TmpBuf[2];
-    uint8_t u8CmdBuf[7] = {CMD_DMA_EXT_READ};
+    uint_fast8_t u8Retry;
+    TRACE_START(u32TraceUs);
 
     WINC_ASSERT(pu8Buf != NULL);
     WINC_ASSERT(u16Sz > 0);
@@ -467,6 +545,29 @@ int_fast8_t winc_bus_read_block(const uint32_t u32Addr, uint8_t *pu8Buf, uint_fa
     }
     bSPIBusError = true;
 
+    // Writing the same data to WINC memory again is harmless
+    for (u8Retry = 0; WINC_BUS_SUCCESS != spi_write_block(u32Addr, pu8Buf, u16Sz); u8Retry++)
+    {
+        if ((u8Retry == SPI_RETRY_COUNT) || (WINC_BUS_SUCCESS != spi_recover()))
+        {
+            TRACE_RECORD(TRACE_EVENT_WINC_WRITE_BLOCK, u32TraceUs, u32Addr, u16Sz, TRACE_STATUS_FAIL);
+            return WINC_BUS_FAIL;
+        }
+    }
+
+    // Clear bus error condition as operation was successful
+    bSPIBusError = false;
+    TRACE_RECORD(TRACE_EVENT_WINC_WRITE_BLOCK, u32TraceUs, u32Addr, u16Sz, u8Retry);
+    WINC_CRIT_SEC_BUS_LEAVE;
+    return WINC_BUS_SUCCESS;
+}
+
+static int_fast8_t spi_read_block(const uint32_t u32Addr, uint8_t *pu8Buf, uint_fast16_t u16Sz)
+{
+    int_fast8_t i8Result;
+    uint8_t u8TmpBuf[2];
+    uint8_t u8CmdBuf[7] = {CMD_DMA_EXT_READ};
+
     // Store address into buffer
     u8CmdBuf[1] = (uint8_t)(u32Addr >> 16);
     u8CmdBuf[2] = (uint8_t)(u32Addr >> 8);
@@ -517,8 +618,39 @@ int_fast8_t winc_bus_read_block(const uint32_t u32Addr, uint8_t *pu8Buf, uint_fa
         return WINC_BUS_FAIL;
     }
 
+    return WINC_BUS_SUCCESS;
+}
+
+int_fast8_t winc_bus_read_block(const uint32_t u32Addr, uint8_t *pu8Buf, uint_fast16_t u16Sz)
+{
+    uint_fast8_t u8Retry;
+    TRACE_START(u32TraceUs);
+
+    WINC_ASSERT(pu8Buf != NULL);
+    WINC_ASSERT(u16Sz > 0);
+
+    // External API: Don't run if bus error is present, preset error so only
+    // successful path leads to clearing the error condition
+    WINC_CRIT_SEC_BUS_ENTER;
+    if (bSPIBusError)
+    {
+        WINC_ASSERT(0);
+        return WINC_BUS_FAIL;
+    }
+    bSPIBusError = true;
+
+    for (u8Retry = 0; WINC_BUS_SUCCESS != spi_read_block(u32Addr, pu8Buf, u16Sz); u8Retry++)
+    {
+        if ((u8Retry == SPI_RETRY_COUNT) || (WINC_BUS_SUCCESS != spi_recover()))
+        {
+            TRACE_RECORD(TRACE_EVENT_WINC_READ_BLOCK, u32TraceUs, u32Addr, u16Sz, TRACE_STATUS_FAIL);
+            return WINC_BUS_FAIL;
+        }
+    }
+
     // Clear bus error condition as operation was successful
     bSPIBusError = false;
+    TRACE_RECORD(TRACE_EVENT_WINC_READ_BLOCK, u32TraceUs, u32Addr, u16Sz, u8Retry);
     WINC_CRIT_SEC_BUS_LEAVE;
     return WINC_BUS_SUCCESS;
 }
@@ -537,6 +669,8 @@ int_fast8_t winc_bus_init(void)
         0x52,
         0x5c
     };
+    int_fast8_t s8Ret;
+    TRACE_START(u32TraceUs);
     
     WINC_CRIT_SEC_BUS_INIT;
 
@@ -544,30 +678,56 @@ int_fast8_t winc_bus_init(void)
     // as first test of SPI bus.
     bSPIBusError = false;
 
-    return spi_cmd_send(u8CmdBuf, 9);
+    s8Ret = spi_cmd_send(u8CmdBuf, 9);
+    TRACE_RECORD(TRACE_EVENT_WINC_INIT, u32TraceUs, NMI_SPI_PROTOCOL_CONFIG, sizeof(u8CmdBuf), (WINC_BUS_SUCCESS == s8Ret) ? 0 : TRACE_STATUS_FAIL);
+
+    return s8Ret;
 }
 
 int_fast8_t winc_bus_reset(void)
 {
-    static const uint8_t u8CmdBuf[5] = {CMD_RESET, 0xff, 0xff, 0xff, 0x00/*, 0xaa*/};
+    int_fast8_t s8Ret;
+    TRACE_START(u32TraceUs);
 
     // Clear bus error condition to allow command send to work
     bSPIBusError = false;
 
+    s8Ret = spi_reset();
+    TRACE_RECORD(TRACE_EVENT_WINC_RESET, u32TraceUs, 0, 5, (WINC_BUS_SUCCESS == s8Ret) ? 0 : TRACE_STATUS_FAIL);
+
 #ifdef WINC_CRIT_SEC_BUS
-    if (WINC_BUS_SUCCESS != spi_cmd_send(u8CmdBuf, 5))
+    if (WINC_BUS_SUCCESS != s8Ret)
     {
         WINC_ASSERT(0);
         return WINC_BUS_FAIL;
     }
 
     WINC_CRIT_SEC_BUS_LEAVE;
+#endif
+
+    return s8Ret;
+}
+
+int_fast8_t winc_bus_recover(void)
+{
+    TRACE_START(u32TraceUs);
+
+    // Keep the error condition latched unless the WINC responds again
+    WINC_CRIT_SEC_BUS_ENTER;
+    bSPIBusError = true;
+
+    if (WINC_BUS_SUCCESS != spi_recover())
+    {
+        WINC_ASSERT(0);
+        TRACE_RECORD(TRACE_EVENT_WINC_RECOVER, u32TraceUs, NMI_CHIPID, 0, TRACE_STATUS_FAIL);
+        return WINC_BUS_FAIL;
+    }
 
+    // Clear bus error condition as operation was successful
+    bSPIBusError = false;
+    TRACE_RECORD(TRACE_EVENT_WINC_RECOVER, u32TraceUs, NMI_CHIPID, 0, 0);
+    WINC_CRIT_SEC_BUS_LEAVE;
     return WINC_BUS_SUCCESS;
-#else
-    // Send command to reset SPI
-    return spi_cmd_send(u8CmdBuf, 5);
-#endif
 }
 
 int_fast8_t winc_bus_deinit(void)
@@ -584,6 +744,8 @@ int_fast8_t winc_bus_deinit(void)
 uint32_t winc_bus_read_reg(const uint32_t u32Addr)
 {
     uint32_t u32Val;
+    uint_fast8_t u8Retry;
+    TRACE_START(u32TraceUs);
 
     // External API: Don't run if bus error is present, preset error so only
     // successful path leads to clearing the error condition
@@ -595,20 +757,28 @@ uint32_t winc_bus_read_reg(const uint32_t u32Addr)
     }
     bSPIBusError = true;
 
-    if (WINC_BUS_SUCCESS != spi_read_reg(u32Addr, &u32Val))
+    for (u8Retry = 0; WINC_BUS_SUCCESS != spi_read_reg(u32Addr, &u32Val); u8Retry++)
     {
-        WINC_ASSERT(0);
-        return 0;
+        if ((u8Retry == SPI_RETRY_COUNT) || (WINC_BUS_SUCCESS != spi_recover()))
+        {
+            WINC_ASSERT(0);
+            TRACE_RECORD(TRACE_EVENT_WINC_READ_REG, u32TraceUs, u32Addr, 4, TRACE_STATUS_FAIL);
+            return 0;
+        }
     }
 
     // Clear bus error condition as operation was successful
     bSPIBusError = false;
+    TRACE_RECORD(TRACE_EVENT_WINC_READ_REG, u32TraceUs, u32Addr, 4, u8Retry);
     WINC_CRIT_SEC_BUS_LEAVE;
     return u32Val;
 }
 
 int_fast8_t winc_bus_read_reg_with_ret(const uint32_t u32Addr, uint32_t *pu32RetVal)
 {
+    uint_fast8_t u8Retry;
+    TRACE_START(u32TraceUs);
+
     WINC_ASSERT(pu32RetVal != NULL);
 
     // External API: Don't run if bus error is present, preset error so only
@@ -621,14 +791,18 @@ int_fast8_t winc_bus_read_reg_with_ret(const uint32_t u32Addr, uint32_t *pu32Ret
     }
     bSPIBusError = true;
 
-    if (WINC_BUS_SUCCESS != spi_read_reg(u32Addr, pu32RetVal))
+    for (u8Retry = 0; WINC_BUS_SUCCESS != spi_read_reg(u32Addr, pu32RetVal); u8Retry++)
     {
-        WINC_ASSERT(0);
-        return WINC_BUS_FAIL;
+        if ((u8Retry == SPI_RETRY_COUNT) || (WINC_BUS_SUCCESS != spi_recover()))
+        {
+            TRACE_RECORD(TRACE_EVENT_WINC_READ_REG, u32TraceUs, u32Addr, 4, TRACE_STATUS_FAIL);
+            return WINC_BUS_FAIL;
+        }
     }
 
      // Clear bus error condition as operation was successful
     bSPIBusError = false;
+    TRACE_RECORD(TRACE_EVENT_WINC_READ_REG, u32TraceUs, u32Addr, 4, u8Retry);
     WINC_CRIT_SEC_BUS_LEAVE;
     return WINC_BUS_SUCCESS;
 }
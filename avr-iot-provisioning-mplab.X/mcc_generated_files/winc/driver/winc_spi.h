@@ -45,13 +45,22 @@
 #define WINC_BUS_SUCCESS  0
 #define WINC_BUS_FAIL     1
 
+/* Register address/value pair for winc_bus_write_reg_seq */
+typedef struct
+{
+    uint32_t u32Addr;
+    uint32_t u32Val;
+} tstrWincBusRegWrite;
+
 int_fast8_t winc_bus_init(void);
 int_fast8_t winc_bus_reset(void);
+int_fast8_t winc_bus_recover(void);
 int_fast8_t winc_bus_deinit(void);
 uint32_t winc_bus_read_reg(const uint32_t u32Addr);
 int_fast8_t winc_bus_read_reg_with_ret(const uint32_t u32Addr, uint32_t *pu32RetVal);
 int_fast8_t winc_bus_write_reg(const uint32_t u32Addr, const uint32_t u32Val);
 int_fast8_t winc_bus_write_reg_no_rsp(const uint32_t u32Addr, const uint32_t u32Val);
+int_fast8_t winc_bus_write_reg_seq(const tstrWincBusRegWrite *pstrRegs, uint_fast8_t u8Count);
 int_fast8_t winc_bus_read_block(const uint32_t u32Addr, uint8_t *pu8Buf, uint_fast16_t u16Sz);
 int_fast8_t winc_bus_write_block(uint32_t u32Addr, const uint8_t *pu8Buf, uint_fast16_t u16Sz);
 int_fast8_t winc_bus_set_reg_bits(uint32_t u32Addr, uint32_t u32Bits);
@@ -44,6 +44,7 @@
 #include "../driver/winc_asic.h"
 #include "../driver/winc_spi.h"
 #include "../spi_flash/spi_flash.h"
+#include "../spi_flash/spi_flash_map.h"
 
 static uint32_t winc_firmware_version_read_addr(void)
 {
@@ -131,3 +132,73 @@ int_fast8_t m2m_fwinfo_get_firmware_info(bool bMainImage, tstrM2mRev* pstrRev)
 
     return M2M_SUCCESS;
 }
+
+static bool m2m_fwinfo_read_control_sec(uint32_t u32Offset, tstrOtaControlSec *pstrControlSec)
+{
+    if (M2M_SUCCESS != spi_flash_read((uint8_t*)pstrControlSec, u32Offset, sizeof(tstrOtaControlSec)))
+    {
+        return false;
+    }
+
+    return (OTA_MAGIC_VALUE == pstrControlSec->u32OtaMagicValue);
+}
+
+int_fast8_t m2m_fwinfo_get_flash_info(bool bMainImage, tstrM2mRev* pstrRev)
+{
+    tstrOtaControlSec strControlSec;
+    tstrOtaControlSec strControlSecBkp;
+    tstrOtaControlSec *pstrControlSec;
+    uint32_t u32Ver;
+    bool bValid, bBkpValid;
+
+    if (NULL == pstrRev)
+    {
+        return M2M_ERR_INVALID_ARG;
+    }
+
+    memset(pstrRev, 0, sizeof(tstrM2mRev));
+
+    bValid    = m2m_fwinfo_read_control_sec(M2M_CONTROL_FLASH_OFFSET, &strControlSec);
+    bBkpValid = m2m_fwinfo_read_control_sec(M2M_CONTROL_FLASH_BKP_OFFSET, &strControlSecBkp);
+
+    /* the two copies are updated in turn, the one with the highest sequence number is the latest */
+    if (bValid && (!bBkpValid || (strControlSec.u32OtaSequenceNumber >= strControlSecBkp.u32OtaSequenceNumber)))
+    {
+        pstrControlSec = &strControlSec;
+    }
+    else if (bBkpValid)
+    {
+        pstrControlSec = &strControlSecBkp;
+    }
+    else
+    {
+        return M2M_ERR_FAIL;
+    }
+
+    if (bMainImage)
+    {
+        u32Ver = pstrControlSec->u32OtaCurrentWorkingImagFirmwareVer;
+    }
+    else
+    {
+        if (OTA_STATUS_VALID != pstrControlSec->u32OtaRollbackImageValidStatus)
+        {
+            return M2M_ERR_FAIL;
+        }
+        u32Ver = pstrControlSec->u32OtaRollbackImagFirmwareVer;
+    }
+
+    if (!u32Ver)
+    {
+        return M2M_ERR_FAIL;
+    }
+
+    pstrRev->u8FirmwareMajor = M2M_GET_FW_MAJOR(u32Ver);
+    pstrRev->u8FirmwareMinor = M2M_GET_FW_MINOR(u32Ver);
+    pstrRev->u8FirmwarePatch = M2M_GET_FW_PATCH(u32Ver);
+    pstrRev->u8DriverMajor   = M2M_GET_DRV_MAJOR(u32Ver);
+    pstrRev->u8DriverMinor   = M2M_GET_DRV_MINOR(u32Ver);
+    pstrRev->u8DriverPatch   = M2M_GET_DRV_PATCH(u32Ver);
+
+    return M2M_SUCCESS;
+}
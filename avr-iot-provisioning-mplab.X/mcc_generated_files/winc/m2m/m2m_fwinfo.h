@@ -46,6 +46,12 @@ int_fast8_t m2m_fwinfo_version_check(tstrM2mRev* pstrRev);
 
 int_fast8_t m2m_fwinfo_get_firmware_info(bool bMainImage, tstrM2mRev* pstrRev);
 
+/* Read the firmware and driver versions of the main or OTA image from the control
+   sector in the SPI flash, the WINC must be in download mode. Only the version
+   numbers are filled in, the chip ID and build information are only available
+   from the running firmware */
+int_fast8_t m2m_fwinfo_get_flash_info(bool bMainImage, tstrM2mRev* pstrRev);
+
 #ifdef __cplusplus
      }
 #endif
@@ -42,36 +42,124 @@
 #include "flexible_flash.h"
 
 #define FLASH_MAP_TABLE_ADDR        (FLASH_SECTOR_SZ+sizeof(tstrOtaControlSec)+8)
+#define FLASH_MAP_TABLE_SECTOR      (FLASH_MAP_TABLE_ADDR / FLASH_SECTOR_SZ)
 #define N_ENTRIES_MAX               32
 
+/* Compact copy of the flash map, only the fields used by the host are kept */
+typedef struct {
+    uint16_t u16Id;
+    uint8_t u8Sector;
+    uint8_t u8Size;
+} tstrFlashMapCacheEntry;
+
+static tstrFlashMapCacheEntry gastrFlashMap[N_ENTRIES_MAX];
+static uint8_t gu8FlashMapEntries;
+static bool gbFlashMapValid = false;
+
+static int8_t spi_flexible_flash_load_map(void)
+{
+    /* entry count followed by the entries, read in one go */
+    uint8_t au8Table[4 + (N_ENTRIES_MAX * sizeof(tstrFlashLUTEntry))];
+    uint8_t *pu8Entry;
+    uint8_t u8Entry;
+    int8_t s8Ret;
+
+    if (gbFlashMapValid)
+        return M2M_SUCCESS;
+
+    s8Ret = spi_flash_read(au8Table, FLASH_MAP_TABLE_ADDR, sizeof(au8Table));
+    if (M2M_SUCCESS != s8Ret)
+        return s8Ret;
+
+    // Max number is 32, reading one byte will suffice
+    if (au8Table[0] > N_ENTRIES_MAX)
+        return M2M_ERR_FAIL;
+
+    gu8FlashMapEntries = au8Table[0];
+    pu8Entry = &au8Table[4];
+
+    for (u8Entry = 0; u8Entry < gu8FlashMapEntries; u8Entry++)
+    {
+        gastrFlashMap[u8Entry].u16Id    = (pu8Entry[1] << 8) | pu8Entry[0];
+        gastrFlashMap[u8Entry].u8Sector = pu8Entry[2];
+        gastrFlashMap[u8Entry].u8Size   = pu8Entry[3];
+        pu8Entry += sizeof(tstrFlashLUTEntry);
+    }
+
+    gbFlashMapValid = true;
+
+    return M2M_SUCCESS;
+}
+
 int8_t spi_flexible_flash_find_section(uint16_t u16EntryIDToLookFor, uint32_t *pu32StartOffset, uint32_t *pu32Size)
 {
     int8_t s8Ret = M2M_ERR_INVALID_ARG;
     if((NULL == pu32StartOffset) || (NULL == pu32Size)) goto EXIT;
 
-    uint8_t au8buff[8];
-    uint8_t u8CurrEntry = 0;
-    s8Ret = spi_flash_read(&au8buff[0], FLASH_MAP_TABLE_ADDR, 4);
+    uint8_t u8CurrEntry;
+    s8Ret = spi_flexible_flash_load_map();
     if(M2M_SUCCESS != s8Ret) goto EXIT;
 
-    uint8_t u8nEntries = au8buff[0];     // Max number is 32, reading one byte will suffice
-    if(u8nEntries > N_ENTRIES_MAX)
+    for(u8CurrEntry = 0; u8CurrEntry < gu8FlashMapEntries; u8CurrEntry++)
     {
-        s8Ret = M2M_ERR_FAIL;
-        goto EXIT;
-    }
-
-    while(u8nEntries > u8CurrEntry)
-    {
-        s8Ret = spi_flash_read(&au8buff[0], FLASH_MAP_TABLE_ADDR + 4 + (u8CurrEntry*8), 8);
-        u8CurrEntry++;
-        if(M2M_SUCCESS != s8Ret) break;
-        uint16_t u16EntryID = (au8buff[1] << 8) | au8buff[0];
-        if(u16EntryID != u16EntryIDToLookFor) continue;
-        *pu32StartOffset = au8buff[2] * FLASH_SECTOR_SZ;
-        *pu32Size        = au8buff[3] * FLASH_SECTOR_SZ;
+        if(gastrFlashMap[u8CurrEntry].u16Id != u16EntryIDToLookFor) continue;
+        *pu32StartOffset = gastrFlashMap[u8CurrEntry].u8Sector * FLASH_SECTOR_SZ;
+        *pu32Size        = gastrFlashMap[u8CurrEntry].u8Size * FLASH_SECTOR_SZ;
         break;
     }
 EXIT:
     return s8Ret;
-}
\ No newline at end of file
+}
+
+int8_t spi_flexible_flash_get_num_entries(uint8_t *pu8Entries)
+{
+    int8_t s8Ret;
+
+    if (NULL == pu8Entries)
+        return M2M_ERR_INVALID_ARG;
+
+    s8Ret = spi_flexible_flash_load_map();
+    if (M2M_SUCCESS != s8Ret)
+        return s8Ret;
+
+    *pu8Entries = gu8FlashMapEntries;
+
+    return M2M_SUCCESS;
+}
+
+int8_t spi_flexible_flash_get_entry(uint8_t u8Index, uint16_t *pu16Id, uint32_t *pu32StartOffset, uint32_t *pu32Size)
+{
+    int8_t s8Ret;
+
+    if ((NULL == pu16Id) || (NULL == pu32StartOffset) || (NULL == pu32Size))
+        return M2M_ERR_INVALID_ARG;
+
+    s8Ret = spi_flexible_flash_load_map();
+    if (M2M_SUCCESS != s8Ret)
+        return s8Ret;
+
+    if (u8Index >= gu8FlashMapEntries)
+        return M2M_ERR_INVALID_ARG;
+
+    *pu16Id          = gastrFlashMap[u8Index].u16Id;
+    *pu32StartOffset = gastrFlashMap[u8Index].u8Sector * FLASH_SECTOR_SZ;
+    *pu32Size        = gastrFlashMap[u8Index].u8Size * FLASH_SECTOR_SZ;
+
+    return M2M_SUCCESS;
+}
+
+void spi_flexible_flash_invalidate(uint32_t u32Offset, uint32_t u32Sz)
+{
+    uint32_t u32FirstSector = u32Offset / FLASH_SECTOR_SZ;
+    uint32_t u32LastSector  = (u32Offset + u32Sz - 1) / FLASH_SECTOR_SZ;
+
+    if ((u32Sz == 0) || (u32FirstSector > FLASH_MAP_TABLE_SECTOR) || (u32LastSector < FLASH_MAP_TABLE_SECTOR))
+        return;
+
+    gbFlashMapValid = false;
+}
+
+void spi_flexible_flash_invalidate_all(void)
+{
+    gbFlashMapValid = false;
+}
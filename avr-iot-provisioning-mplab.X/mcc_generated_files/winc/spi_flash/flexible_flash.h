@@ -84,6 +84,48 @@ typedef struct {
 
  */
  int8_t spi_flexible_flash_find_section(uint16_t u16EntryIDToLookFor, uint32_t *pu32StartOffset, uint32_t *pu32Size);
+
+/*!
+ * @fn          int8_t spi_flexible_flash_get_num_entries(uint8_t *pu8Entries);
+ * @brief       Get the number of entries in the Flash Map.\n
+ * @param [out] pu8Entries
+ *                  Pointer to the variable where the number of entries should be stored.
+ * @return      The function returns @ref M2M_SUCCESS for successful operations and a negative value otherwise.
+ */
+ int8_t spi_flexible_flash_get_num_entries(uint8_t *pu8Entries);
+
+/*!
+ * @fn          int8_t spi_flexible_flash_get_entry(uint8_t u8Index, uint16_t *pu16Id, uint32_t *pu32StartOffset, uint32_t *pu32Size);
+ * @brief       Get one entry of the Flash Map.\n
+ * @param [in]  u8Index
+ *                  Index of the entry, must be less than the value returned by @ref spi_flexible_flash_get_num_entries.
+ * @param [out] pu16Id
+ *                  Pointer to the variable where the entry ID should be stored. See @ref tenuFlashLUTEntryID.
+ * @param [out] pu32StartOffset
+ *                  Pointer to the variable where the Flash section start address should be stored.
+ * @param [out] pu32Size
+ *                  Pointer to the variable where the Flash section size should be stored.
+ * @return      The function returns @ref M2M_SUCCESS for successful operations and a negative value otherwise.
+ */
+ int8_t spi_flexible_flash_get_entry(uint8_t u8Index, uint16_t *pu16Id, uint32_t *pu32StartOffset, uint32_t *pu32Size);
+
+/*!
+ * @fn          void spi_flexible_flash_invalidate(uint32_t u32Offset, uint32_t u32Sz);
+ * @brief       Drop the cached Flash Map if the given range overlaps the sector holding it.\n
+ *              Called by the SPI flash driver for every write and erase.
+ * @param [in]  u32Offset
+ *                  Start address of the modified range.
+ * @param [in]  u32Sz
+ *                  Size of the modified range.
+ */
+ void spi_flexible_flash_invalidate(uint32_t u32Offset, uint32_t u32Sz);
+
+/*!
+ * @fn          void spi_flexible_flash_invalidate_all(void);
+ * @brief       Drop the cached Flash Map.\n
+ *              Used when the WINC is restarted as the running firmware may have updated the Flash Map.
+ */
+ void spi_flexible_flash_invalidate_all(void);
  /**@}*/
 
 #endif /* __FLEXIBLE_FLASH_H__ */
@@ -42,196 +42,529 @@
 #include "../driver/winc_asic.h"
 #include "spi_flash.h"
 #include "spi_flash_map.h"
+#include "flexible_flash.h"
+#include "../../include/counters.h"
 
 #define HOST_SHARE_MEM_BASE     (0xd0000UL)
+#define HOST_SHARE_MEM_SLOTS    (2)
+
+/* Reads are staged in two areas of shared memory after the page program
+   slots, the next block of a sequential read is loaded into one while the
+   other is read by the host */
+#define SPI_FLASH_READ_MEM_BASE (HOST_SHARE_MEM_BASE + (HOST_SHARE_MEM_SLOTS * FLASH_PAGE_SZ))
+#define SPI_FLASH_READ_SLOT_SZ  (FLASH_SECTOR_SZ)
+#define SPI_FLASH_READ_SLOTS    (2)
+
+/* A copy of one sector can be kept in shared memory after the read slots
+   while the sector itself is erased and rewritten */
+#define SPI_FLASH_SNAPSHOT_MEM_BASE (SPI_FLASH_READ_MEM_BASE + (SPI_FLASH_READ_SLOTS * SPI_FLASH_READ_SLOT_SZ))
+#define SPI_FLASH_SNAPSHOT_SZ       (FLASH_SECTOR_SZ)
+
+/* Programmed pages are compared with the staged data in chunks of this size */
+#define SPI_FLASH_VERIFY_CHUNK_SZ   (32)
+
+/* A SPI clock is accepted when a page of test data makes it to shared memory
+   and back intact, in chunks of this size */
+#define SPI_FLASH_TUNE_CHUNK_SZ     (64)
+
+#define SPI_FLASH_REG_SEQ_LEN(a)    (sizeof(a) / sizeof(a[0]))
+
+/* Typical and worst case durations of flash operations, used to pace status polling */
+#define SPI_FLASH_PP_EXPECTED_US        (700UL)
+#define SPI_FLASH_PP_TIMEOUT_US         (10000UL)
+#define SPI_FLASH_SE_EXPECTED_US        (40000UL)
+#define SPI_FLASH_SE_TIMEOUT_US         (1000000UL)
+#define SPI_FLASH_TR_DONE_TIMEOUT_US    (50000UL)
+#define SPI_FLASH_POLL_MIN_US           (50UL)
+#define SPI_FLASH_POLL_MAX_US           (2000UL)
 /***********************************************************
 SPI Flash DMA
 ***********************************************************/
 
 static uint32_t gu32InternalFlashSize = 0;
 
+/* Page programming is pipelined, the next page is staged in the other
+   shared memory slot while the flash is still busy with the previous one */
+static uint8_t gu8StagingSlot = 0;
+static bool gbProgramPending = false;
+static uint32_t gu32ProgramStartUs;
+static uint32_t gu32ProgramMemAdr;
+static uint32_t gu32ProgramFlashAdr;
+static uint_fast16_t gu16ProgramSz;
+static bool gbVerify = false;
+
+/* Background sector erase, like a page program it is completed before the
+   next flash operation */
+static bool gbErasePending = false;
+static uint32_t gu32EraseStartUs;
+
+/* Read ahead, the flash controller may still be busy loading the block
+   following the last read when the next flash operation starts. The block
+   stays valid until the range is written or erased */
+static bool gbReadAheadPending = false;
+static bool gbReadAheadValid = false;
+static uint8_t gu8ReadAheadSlot = 0;
+static uint32_t gu32ReadAheadAddr;
+static uint32_t gu32ReadAheadSz;
+
+static tstrSpiFlashTiming gastrTiming[SPI_FLASH_OP_COUNT];
+
 /*********************************************/
 /* STATIC FUNCTIONS                          */
 /*********************************************/
 
-static int8_t spi_flash_read_status_reg(uint8_t *pu8Val)
+static int8_t spi_flash_wait_tr_done(void)
 {
     uint32_t u32Reg;
+    uint32_t u32StartUs;
+
+    u32StartUs = winc_adapter_time_us();
 
-    winc_bus_write_reg(SPI_FLASH_DATA_CNT, 4);
-    winc_bus_write_reg(SPI_FLASH_BUF1, 0x05);
-    winc_bus_write_reg(SPI_FLASH_BUF_DIR, 0x01);
-    winc_bus_write_reg(SPI_FLASH_DMA_ADDR, DUMMY_REGISTER);
-    winc_bus_write_reg(SPI_FLASH_CMD_CNT, 1 | (1<<7));
     do
     {
         if (WINC_BUS_SUCCESS != winc_bus_read_reg_with_ret(SPI_FLASH_TR_DONE, &u32Reg))
-            break;
+            return M2M_ERR_FAIL;
+
+        if ((winc_adapter_time_us() - u32StartUs) > SPI_FLASH_TR_DONE_TIMEOUT_US)
+        {
+            WINC_LOG_ERROR("Flash transfer timeout");
+            return M2M_ERR_TIME_OUT;
+        }
     }
     while(u32Reg != 1);
 
-    u32Reg = winc_bus_read_reg(DUMMY_REGISTER);
+    return M2M_SUCCESS;
+}
 
-    if (winc_bus_error())
+static int8_t spi_flash_cmd_start(const tstrWincBusRegWrite *pstrRegs, uint_fast8_t u8Count)
+{
+    /* the whole command descriptor is pushed in one register sequence */
+    if (WINC_BUS_SUCCESS != winc_bus_write_reg_seq(pstrRegs, u8Count))
         return M2M_ERR_FAIL;
 
-    *pu8Val = (uint8_t)(u32Reg & 0xff);
-
     return M2M_SUCCESS;
 }
 
-static int8_t spi_flash_load_to_cortus_mem(uint32_t u32MemAdr, uint32_t u32FlashAdr, uint32_t u32Sz)
+static int8_t spi_flash_cmd_wait(void)
 {
-    uint32_t u32Reg;
-
-    u32FlashAdr = CONF_WINC_UINT32_SWAP(u32FlashAdr);       // 24bit address swapped and placed in top 24bits
-    u32FlashAdr |= 0x0b;
+    int8_t s8Ret;
 
-    winc_bus_write_reg(SPI_FLASH_DATA_CNT, u32Sz);
-    winc_bus_write_reg(SPI_FLASH_BUF1, u32FlashAdr);
-    winc_bus_write_reg(SPI_FLASH_BUF2, 0xa5);
-    winc_bus_write_reg(SPI_FLASH_BUF_DIR, 0x1f);
-    winc_bus_write_reg(SPI_FLASH_DMA_ADDR, u32MemAdr);
-    winc_bus_write_reg(SPI_FLASH_CMD_CNT, 5 | (1<<7));
-    do
-    {
-        if (WINC_BUS_SUCCESS != winc_bus_read_reg_with_ret(SPI_FLASH_TR_DONE, &u32Reg))
-            break;
-    }
-    while(u32Reg != 1);
+    s8Ret = spi_flash_wait_tr_done();
 
     if (winc_bus_error())
         return M2M_ERR_FAIL;
 
-    return M2M_SUCCESS;
+    return s8Ret;
 }
 
-static int8_t spi_flash_sector_erase(uint32_t u32FlashAdr)
+static int8_t spi_flash_cmd(const tstrWincBusRegWrite *pstrRegs, uint_fast8_t u8Count)
 {
-    uint32_t u32Reg;
+    if (M2M_SUCCESS != spi_flash_cmd_start(pstrRegs, u8Count))
+        return M2M_ERR_FAIL;
 
-    u32FlashAdr = CONF_WINC_UINT32_SWAP(u32FlashAdr);       // 24bit address swapped and placed in top 24bits
-    u32FlashAdr |= 0x20;
+    return spi_flash_cmd_wait();
+}
 
-    winc_bus_write_reg(SPI_FLASH_DATA_CNT, 0);
-    winc_bus_write_reg(SPI_FLASH_BUF1, u32FlashAdr);
-    winc_bus_write_reg(SPI_FLASH_BUF_DIR, 0x0f);
-    winc_bus_write_reg(SPI_FLASH_DMA_ADDR, 0);
-    winc_bus_write_reg(SPI_FLASH_CMD_CNT, 4 | (1<<7));
-    do
+static int8_t spi_flash_read_status_reg(uint8_t *pu8Val)
+{
+    uint32_t u32Reg;
+    const tstrWincBusRegWrite strRegs[] =
     {
-        if (WINC_BUS_SUCCESS != winc_bus_read_reg_with_ret(SPI_FLASH_TR_DONE, &u32Reg))
-            break;
-    }
-    while(u32Reg != 1);
+        {SPI_FLASH_DATA_CNT,    4},
+        {SPI_FLASH_BUF1,        0x05},
+        {SPI_FLASH_BUF_DIR,     0x01},
+        {SPI_FLASH_DMA_ADDR,    DUMMY_REGISTER},
+        {SPI_FLASH_CMD_CNT,     1 | (1<<7)}
+    };
+
+    if (M2M_SUCCESS != spi_flash_cmd(strRegs, SPI_FLASH_REG_SEQ_LEN(strRegs)))
+        return M2M_ERR_FAIL;
+
+    u32Reg = winc_bus_read_reg(DUMMY_REGISTER);
 
     if (winc_bus_error())
         return M2M_ERR_FAIL;
 
+    *pu8Val = (uint8_t)(u32Reg & 0xff);
+
     return M2M_SUCCESS;
 }
 
-static int8_t spi_flash_write_enable(void)
+static int8_t spi_flash_load_to_cortus_mem_start(uint32_t u32MemAdr, uint32_t u32FlashAdr, uint32_t u32Sz)
 {
-    uint32_t u32Reg;
-
-    winc_bus_write_reg(SPI_FLASH_DATA_CNT, 0);
-    winc_bus_write_reg(SPI_FLASH_BUF1, 0x06);
-    winc_bus_write_reg(SPI_FLASH_BUF_DIR, 0x01);
-    winc_bus_write_reg(SPI_FLASH_DMA_ADDR, 0);
-    winc_bus_write_reg(SPI_FLASH_CMD_CNT, 1 | (1<<7));
-    do
+    const tstrWincBusRegWrite strRegs[] =
     {
-        if (WINC_BUS_SUCCESS != winc_bus_read_reg_with_ret(SPI_FLASH_TR_DONE, &u32Reg))
-            break;
-    }
-    while(u32Reg != 1);
+        {SPI_FLASH_DATA_CNT,    u32Sz},
+        {SPI_FLASH_BUF1,        CONF_WINC_UINT32_SWAP(u32FlashAdr) | 0x0b},   // 24bit address swapped and placed in top 24bits
+        {SPI_FLASH_BUF2,        0xa5},
+        {SPI_FLASH_BUF_DIR,     0x1f},
+        {SPI_FLASH_DMA_ADDR,    u32MemAdr},
+        {SPI_FLASH_CMD_CNT,     5 | (1<<7)}
+    };
+
+    return spi_flash_cmd_start(strRegs, SPI_FLASH_REG_SEQ_LEN(strRegs));
+}
 
-    if (winc_bus_error())
+static int8_t spi_flash_load_to_cortus_mem(uint32_t u32MemAdr, uint32_t u32FlashAdr, uint32_t u32Sz)
+{
+    if (M2M_SUCCESS != spi_flash_load_to_cortus_mem_start(u32MemAdr, u32FlashAdr, u32Sz))
         return M2M_ERR_FAIL;
 
-    return M2M_SUCCESS;
+    return spi_flash_cmd_wait();
+}
+
+static int8_t spi_flash_sector_erase(uint32_t u32FlashAdr)
+{
+    const tstrWincBusRegWrite strRegs[] =
+    {
+        {SPI_FLASH_DATA_CNT,    0},
+        {SPI_FLASH_BUF1,        CONF_WINC_UINT32_SWAP(u32FlashAdr) | 0x20},   // 24bit address swapped and placed in top 24bits
+        {SPI_FLASH_BUF_DIR,     0x0f},
+        {SPI_FLASH_DMA_ADDR,    0},
+        {SPI_FLASH_CMD_CNT,     4 | (1<<7)}
+    };
+    int8_t s8Ret;
+
+    s8Ret = spi_flash_cmd(strRegs, SPI_FLASH_REG_SEQ_LEN(strRegs));
+    if (M2M_SUCCESS == s8Ret)
+        counters_sector_erased(u32FlashAdr);
+
+    return s8Ret;
+}
+
+static int8_t spi_flash_write_enable(void)
+{
+    const tstrWincBusRegWrite strRegs[] =
+    {
+        {SPI_FLASH_DATA_CNT,    0},
+        {SPI_FLASH_BUF1,        0x06},
+        {SPI_FLASH_BUF_DIR,     0x01},
+        {SPI_FLASH_DMA_ADDR,    0},
+        {SPI_FLASH_CMD_CNT,     1 | (1<<7)}
+    };
+
+    return spi_flash_cmd(strRegs, SPI_FLASH_REG_SEQ_LEN(strRegs));
 }
 
 static int8_t spi_flash_write_disable(void)
 {
-    uint32_t u32Reg;
+    const tstrWincBusRegWrite strRegs[] =
+    {
+        {SPI_FLASH_DATA_CNT,    0},
+        {SPI_FLASH_BUF1,        0x04},
+        {SPI_FLASH_BUF_DIR,     0x01},
+        {SPI_FLASH_DMA_ADDR,    0},
+        {SPI_FLASH_CMD_CNT,     1 | (1<<7)}
+    };
+
+    return spi_flash_cmd(strRegs, SPI_FLASH_REG_SEQ_LEN(strRegs));
+}
 
-    winc_bus_write_reg(SPI_FLASH_DATA_CNT, 0);
-    winc_bus_write_reg(SPI_FLASH_BUF1, 0x04);
-    winc_bus_write_reg(SPI_FLASH_BUF_DIR, 0x01);
-    winc_bus_write_reg(SPI_FLASH_DMA_ADDR, 0);
-    winc_bus_write_reg(SPI_FLASH_CMD_CNT, 1 | (1<<7));
-    do
+static int8_t spi_flash_page_program(uint32_t u32MemAdr, uint32_t u32FlashAdr, uint32_t u32Sz)
+{
+    const tstrWincBusRegWrite strRegs[] =
     {
-        if (WINC_BUS_SUCCESS != winc_bus_read_reg_with_ret(SPI_FLASH_TR_DONE, &u32Reg))
+        {SPI_FLASH_DATA_CNT,    0},
+        {SPI_FLASH_BUF1,        CONF_WINC_UINT32_SWAP(u32FlashAdr) | 0x02},   // 24bit address swapped and placed in top 24bits
+        {SPI_FLASH_BUF_DIR,     0x0f},
+        {SPI_FLASH_DMA_ADDR,    u32MemAdr},
+        {SPI_FLASH_CMD_CNT,     4 | (1<<7) | ((u32Sz & 0xfffff) << 8)}
+    };
+    int8_t s8Ret;
+
+    s8Ret = spi_flash_cmd(strRegs, SPI_FLASH_REG_SEQ_LEN(strRegs));
+    if (M2M_SUCCESS == s8Ret)
+        COUNTER_INC(winc_pages_programmed);
+
+    return s8Ret;
+}
+
+static void spi_flash_timing_add(tstrSpiFlashTiming *pstrTiming, uint32_t u32DurationUs)
+{
+    if (!pstrTiming->u32Count || (u32DurationUs < pstrTiming->u32MinUs))
+        pstrTiming->u32MinUs = u32DurationUs;
+
+    if (u32DurationUs > pstrTiming->u32MaxUs)
+        pstrTiming->u32MaxUs = u32DurationUs;
+
+    pstrTiming->u32TotalUs += u32DurationUs;
+    pstrTiming->u32Count++;
+}
+
+static int8_t spi_flash_wait_wip(tenuSpiFlashOp enuOp, uint32_t u32StartUs, uint32_t u32ExpectedUs, uint32_t u32TimeoutUs)
+{
+    tstrSpiFlashTiming *pstrTiming = &gastrTiming[enuOp];
+    uint32_t u32ElapsedUs;
+    uint32_t u32PollUs;
+    uint32_t u32PollMaxUs;
+    uint8_t u8Reg;
+    bool bMeasured;
+
+    /* once the operation has been measured its fastest completion is a better guess */
+    if (pstrTiming->u32Count)
+        u32ExpectedUs = pstrTiming->u32MinUs;
+
+    /* don't touch the bus during the first half of the expected time. If that has already
+       passed (completion was deferred) the duration would be overestimated so it isn't recorded */
+    u32ElapsedUs = winc_adapter_time_us() - u32StartUs;
+    bMeasured = (u32ElapsedUs < (u32ExpectedUs / 2));
+    if (bMeasured)
+        winc_adapter_delay_us((u32ExpectedUs / 2) - u32ElapsedUs);
+
+    /* back off exponentially, but never sleep for more than a quarter of the expected time */
+    u32PollUs = SPI_FLASH_POLL_MIN_US;
+    u32PollMaxUs = u32ExpectedUs / 4;
+    if (u32PollMaxUs > SPI_FLASH_POLL_MAX_US)
+        u32PollMaxUs = SPI_FLASH_POLL_MAX_US;
+
+    while(1)
+    {
+        if (M2M_SUCCESS != spi_flash_read_status_reg(&u8Reg))
+            return M2M_ERR_FAIL;
+
+        u32ElapsedUs = winc_adapter_time_us() - u32StartUs;
+
+        if (!(u8Reg & 0x01))
             break;
+
+        bMeasured = true;
+
+        if (u32ElapsedUs > u32TimeoutUs)
+        {
+            WINC_LOG_ERROR("Flash busy timeout");
+            return M2M_ERR_TIME_OUT;
+        }
+
+        winc_adapter_delay_us(u32PollUs);
+
+        if (u32PollUs < u32PollMaxUs)
+            u32PollUs <<= 1;
     }
-    while(u32Reg != 1);
 
-    if (winc_bus_error())
-        return M2M_ERR_FAIL;
+    if (bMeasured)
+        spi_flash_timing_add(pstrTiming, u32ElapsedUs);
 
     return M2M_SUCCESS;
 }
 
-static int8_t spi_flash_page_program(uint32_t u32MemAdr, uint32_t u32FlashAdr, uint32_t u32Sz)
+static int8_t spi_flash_read_ahead_complete(void)
 {
-    uint32_t u32Reg;
+    int8_t s8Ret;
 
-    u32FlashAdr = CONF_WINC_UINT32_SWAP(u32FlashAdr);       // 24bit address swapped and placed in top 24bits
-    u32FlashAdr |= 0x02;
+    if (!gbReadAheadPending)
+        return M2M_SUCCESS;
 
-    winc_bus_write_reg(SPI_FLASH_DATA_CNT, 0);
-    winc_bus_write_reg(SPI_FLASH_BUF1, u32FlashAdr);
-    winc_bus_write_reg(SPI_FLASH_BUF_DIR, 0x0f);
-    winc_bus_write_reg(SPI_FLASH_DMA_ADDR, u32MemAdr);
-    winc_bus_write_reg(SPI_FLASH_CMD_CNT, 4 | (1<<7) | ((u32Sz & 0xfffff) << 8));
-    do
+    gbReadAheadPending = false;
+
+    s8Ret = spi_flash_cmd_wait();
+    if (M2M_SUCCESS != s8Ret)
+        gbReadAheadValid = false;
+
+    return s8Ret;
+}
+
+static void spi_flash_read_ahead_invalidate(uint32_t u32Offset, uint32_t u32Sz)
+{
+    if ((u32Offset < (gu32ReadAheadAddr + gu32ReadAheadSz)) && (gu32ReadAheadAddr < (u32Offset + u32Sz)))
+        gbReadAheadValid = false;
+}
+
+static void spi_flash_read_ahead_start(uint32_t u32Addr, uint32_t u32Sz)
+{
+    uint32_t u32MemAdr;
+
+    /* reads past the end of the flash are not started (flash size is in megabits) */
+    if (!u32Sz || (gu32InternalFlashSize && ((u32Addr + u32Sz) > (gu32InternalFlashSize * (1024UL * 1024UL / 8)))))
+        return;
+
+    u32MemAdr = SPI_FLASH_READ_MEM_BASE + ((uint32_t)gu8ReadAheadSlot * SPI_FLASH_READ_SLOT_SZ);
+
+    if (M2M_SUCCESS != spi_flash_load_to_cortus_mem_start(u32MemAdr, u32Addr, u32Sz))
+        return;
+
+    gu32ReadAheadAddr = u32Addr;
+    gu32ReadAheadSz = u32Sz;
+    gbReadAheadPending = true;
+    gbReadAheadValid = true;
+}
+
+static int8_t spi_flash_pp_verify(void)
+{
+    uint8_t au8Flash[SPI_FLASH_VERIFY_CHUNK_SZ];
+    uint8_t au8Staged[SPI_FLASH_VERIFY_CHUNK_SZ];
+    uint32_t u32MemAdr;
+    uint_fast16_t u16Offset;
+    uint_fast16_t u16Sz;
+
+    /* the read slot not holding the read ahead block is free */
+    u32MemAdr = SPI_FLASH_READ_MEM_BASE + ((uint32_t)((gu8ReadAheadSlot + 1) % SPI_FLASH_READ_SLOTS) * SPI_FLASH_READ_SLOT_SZ);
+
+    if (M2M_SUCCESS != spi_flash_load_to_cortus_mem(u32MemAdr, gu32ProgramFlashAdr, gu16ProgramSz))
+        return M2M_ERR_FAIL;
+
+    /* the staged page is still in its slot, the other slot may hold the next page */
+    for (u16Offset = 0; u16Offset < gu16ProgramSz; u16Offset += u16Sz)
     {
-        if (WINC_BUS_SUCCESS != winc_bus_read_reg_with_ret(SPI_FLASH_TR_DONE, &u32Reg))
-            break;
+        u16Sz = gu16ProgramSz - u16Offset;
+        if (u16Sz > SPI_FLASH_VERIFY_CHUNK_SZ)
+            u16Sz = SPI_FLASH_VERIFY_CHUNK_SZ;
+
+        if (WINC_BUS_SUCCESS != winc_bus_read_block(u32MemAdr + u16Offset, au8Flash, u16Sz))
+            return M2M_ERR_FAIL;
+        if (WINC_BUS_SUCCESS != winc_bus_read_block(gu32ProgramMemAdr + u16Offset, au8Staged, u16Sz))
+            return M2M_ERR_FAIL;
+
+        if (memcmp(au8Flash, au8Staged, u16Sz))
+        {
+            WINC_LOG_ERROR("Verify failed at %" PRIx32, gu32ProgramFlashAdr + u16Offset);
+            return SPI_FLASH_ERR_VERIFY;
+        }
     }
-    while(u32Reg != 1);
+
+    return M2M_SUCCESS;
+}
+
+static int8_t spi_flash_pp_complete(void)
+{
+    int8_t s8Ret;
+
+    if (!gbProgramPending)
+        return M2M_SUCCESS;
+
+    s8Ret = spi_flash_wait_wip(SPI_FLASH_OP_PAGE_PROGRAM, gu32ProgramStartUs, SPI_FLASH_PP_EXPECTED_US, SPI_FLASH_PP_TIMEOUT_US);
+    if (M2M_SUCCESS != s8Ret)
+        return s8Ret;
+
+    if (M2M_SUCCESS != spi_flash_write_disable())
+        return M2M_ERR_FAIL;
 
     if (winc_bus_error())
         return M2M_ERR_FAIL;
 
-    return M2M_SUCCESS;
+    if (gbVerify)
+        s8Ret = spi_flash_pp_verify();
+
+    /* the page stays pending until its outcome is known, so that a pipeline
+       reset reports it as lost. A verify mismatch is a known outcome */
+    if ((M2M_SUCCESS == s8Ret) || (SPI_FLASH_ERR_VERIFY == s8Ret))
+        gbProgramPending = false;
+
+    return s8Ret;
+}
+
+static int8_t spi_flash_erase_complete(void)
+{
+    int8_t s8Ret;
+
+    if (!gbErasePending)
+        return M2M_SUCCESS;
+
+    s8Ret = spi_flash_wait_wip(SPI_FLASH_OP_SECTOR_ERASE, gu32EraseStartUs, SPI_FLASH_SE_EXPECTED_US, SPI_FLASH_SE_TIMEOUT_US);
+    if (M2M_SUCCESS == s8Ret)
+        gbErasePending = false;
+
+    return s8Ret;
 }
 
-static int8_t spi_flash_read_internal(uint8_t *pu8Buf, uint32_t u32Addr, uint32_t u32Sz)
+/* a page program and a sector erase are never pending at the same time */
+static int8_t spi_flash_write_complete(void)
 {
-    /* read size must be < 64KB */
-    if (M2M_SUCCESS != spi_flash_load_to_cortus_mem(HOST_SHARE_MEM_BASE, u32Addr, u32Sz))
+    int8_t s8Ret;
+
+    s8Ret = spi_flash_erase_complete();
+    if (M2M_SUCCESS != s8Ret)
+        return s8Ret;
+
+    return spi_flash_pp_complete();
+}
+
+static int8_t spi_flash_read_internal(uint8_t *pu8Buf, uint32_t u32Addr, uint32_t u32Sz, uint32_t u32NextSz)
+{
+    uint32_t u32MemAdr;
+    int8_t s8Ret;
+    bool bHit;
+
+    bHit = gbReadAheadValid && (u32Addr == gu32ReadAheadAddr) && (u32Sz <= gu32ReadAheadSz);
+
+    /* if the block has already been requested it is normally loaded by now */
+    if (M2M_SUCCESS != spi_flash_read_ahead_complete())
         return M2M_ERR_FAIL;
 
-    if (WINC_BUS_SUCCESS != winc_bus_read_block(HOST_SHARE_MEM_BASE, pu8Buf, u32Sz))
+    u32MemAdr = SPI_FLASH_READ_MEM_BASE + ((uint32_t)gu8ReadAheadSlot * SPI_FLASH_READ_SLOT_SZ);
+
+    if (!bHit)
+    {
+        s8Ret = spi_flash_write_complete();
+        if (M2M_SUCCESS != s8Ret)
+            return s8Ret;
+
+        if (M2M_SUCCESS != spi_flash_load_to_cortus_mem(u32MemAdr, u32Addr, u32Sz))
+            return M2M_ERR_FAIL;
+    }
+
+    gbReadAheadValid = false;
+    gu8ReadAheadSlot = (gu8ReadAheadSlot + 1) % SPI_FLASH_READ_SLOTS;
+
+    /* start loading the following block into the other slot before draining
+       this one. If a page is still being programmed or a sector erased the block
+       is drained first and the next load is started once the flash is idle */
+    if (!gbProgramPending && !gbErasePending)
+        spi_flash_read_ahead_start(u32Addr + u32Sz, u32NextSz);
+
+    if (WINC_BUS_SUCCESS != winc_bus_read_block(u32MemAdr, pu8Buf, u32Sz))
         return M2M_ERR_FAIL;
 
+    if (gbProgramPending || gbErasePending)
+    {
+        s8Ret = spi_flash_write_complete();
+        if (M2M_SUCCESS != s8Ret)
+            return s8Ret;
+
+        spi_flash_read_ahead_start(u32Addr + u32Sz, u32NextSz);
+    }
+
     return M2M_SUCCESS;
 }
 
+/* finish whatever the flash controller is still doing in the background,
+   a read ahead load is never pending at the same time as a write */
+static int8_t spi_flash_complete(void)
+{
+    if (M2M_SUCCESS != spi_flash_read_ahead_complete())
+        return M2M_ERR_FAIL;
+
+    return spi_flash_write_complete();
+}
+
 static int8_t spi_flash_pp(uint32_t u32Offset, uint8_t *pu8Buf, uint_fast16_t u16Sz)
 {
-    uint8_t u8Reg;
+    uint32_t u32MemAdr;
+    int8_t s8Ret;
 
-    /* use shared packet memory as temp mem */
-    if (WINC_BUS_SUCCESS != winc_bus_write_block(HOST_SHARE_MEM_BASE, pu8Buf, u16Sz))
+    /* use shared packet memory as temp mem, the slot not used by the
+       page currently being programmed can be filled straight away */
+    u32MemAdr = HOST_SHARE_MEM_BASE + ((uint32_t)gu8StagingSlot * FLASH_PAGE_SZ);
+
+    if (WINC_BUS_SUCCESS != winc_bus_write_block(u32MemAdr, pu8Buf, u16Sz))
         return M2M_ERR_FAIL;
 
-    spi_flash_write_enable();
-    spi_flash_page_program(HOST_SHARE_MEM_BASE, u32Offset, u16Sz);
-    spi_flash_read_status_reg(&u8Reg);
+    /* the flash controller must be idle before the next command */
+    s8Ret = spi_flash_complete();
+    if (M2M_SUCCESS != s8Ret)
+        return s8Ret;
 
-    do
-    {
-        if (M2M_SUCCESS != spi_flash_read_status_reg(&u8Reg))
-            break;
-    }
-    while(u8Reg & 0x01);
+    if (M2M_SUCCESS != spi_flash_write_enable())
+        return M2M_ERR_FAIL;
+    if (M2M_SUCCESS != spi_flash_page_program(u32MemAdr, u32Offset, u16Sz))
+        return M2M_ERR_FAIL;
 
-    spi_flash_write_disable();
+    /* completion is checked before the next flash operation */
+    gu32ProgramStartUs = winc_adapter_time_us();
+    gu32ProgramMemAdr = u32MemAdr;
+    gu32ProgramFlashAdr = u32Offset;
+    gu16ProgramSz = u16Sz;
+    gbProgramPending = true;
+    gu8StagingSlot = (gu8StagingSlot + 1) % HOST_SHARE_MEM_SLOTS;
 
     if (winc_bus_error())
         return M2M_ERR_FAIL;
@@ -242,21 +575,17 @@ static int8_t spi_flash_pp(uint32_t u32Offset, uint8_t *pu8Buf, uint_fast16_t u1
 static uint32_t spi_flash_rdid(void)
 {
     uint32_t u32Reg;
-    uint_fast16_t u16Cnt;
-
-    winc_bus_write_reg(SPI_FLASH_DATA_CNT, 4);
-    winc_bus_write_reg(SPI_FLASH_BUF1, 0x9f);
-    winc_bus_write_reg(SPI_FLASH_BUF_DIR, 0x1);
-    winc_bus_write_reg(SPI_FLASH_DMA_ADDR, DUMMY_REGISTER);
-    winc_bus_write_reg(SPI_FLASH_CMD_CNT, 1 | (1<<7));
-
-    u16Cnt = 500;
-    do
+    const tstrWincBusRegWrite strRegs[] =
     {
-        if (WINC_BUS_SUCCESS != winc_bus_read_reg_with_ret(SPI_FLASH_TR_DONE, &u32Reg))
-            break;
-    }
-    while((u32Reg != 1) && (u16Cnt--));
+        {SPI_FLASH_DATA_CNT,    4},
+        {SPI_FLASH_BUF1,        0x9f},
+        {SPI_FLASH_BUF_DIR,     0x1},
+        {SPI_FLASH_DMA_ADDR,    DUMMY_REGISTER},
+        {SPI_FLASH_CMD_CNT,     1 | (1<<7)}
+    };
+
+    if (M2M_SUCCESS != spi_flash_cmd(strRegs, SPI_FLASH_REG_SEQ_LEN(strRegs)))
+        return 0;
 
     u32Reg = winc_bus_read_reg(DUMMY_REGISTER);
 
@@ -274,8 +603,19 @@ static uint32_t spi_flash_rdid(void)
 
 int8_t spi_flash_enable(uint8_t enable)
 {
-    uint32_t u32Reg;
     uint32_t u32Val;
+    tstrWincBusRegWrite strRegs[] =
+    {
+        {NMI_PIN_MUX_1,         0},
+        {SPI_FLASH_DATA_CNT,    0},
+        {SPI_FLASH_BUF1,        0xb9},
+        {SPI_FLASH_BUF_DIR,     0x1},
+        {SPI_FLASH_DMA_ADDR,    0},
+        {SPI_FLASH_CMD_CNT,     1 | (1 << 7)}
+    };
+
+    if (M2M_SUCCESS != spi_flash_complete())
+        return M2M_ERR_FAIL;
 
     if(REV(winc_chip_get_id()) >= REV_3A0)
     {
@@ -287,30 +627,18 @@ int8_t spi_flash_enable(uint8_t enable)
         u32Val &= ~((0x7777ul) << 12);
         u32Val |= ((0x1111ul) << 12);
 
-        winc_bus_write_reg(NMI_PIN_MUX_1, u32Val);
-
-        winc_bus_write_reg(SPI_FLASH_DATA_CNT, 0);
+        strRegs[0].u32Val = u32Val;
         if(enable)
         {
-            winc_bus_write_reg(SPI_FLASH_BUF1, 0xab);
+            strRegs[2].u32Val = 0xab;
         }
-        else
-        {
-            winc_bus_write_reg(SPI_FLASH_BUF1, 0xb9);
-        }
-        winc_bus_write_reg(SPI_FLASH_BUF_DIR, 0x1);
-        winc_bus_write_reg(SPI_FLASH_DMA_ADDR, 0);
-        winc_bus_write_reg(SPI_FLASH_CMD_CNT,  1 | (1 << 7));
+
+        winc_bus_write_reg_seq(strRegs, SPI_FLASH_REG_SEQ_LEN(strRegs));
 
         if (winc_bus_error())
             return M2M_ERR_FAIL;
 
-        do
-        {
-            if (WINC_BUS_SUCCESS != winc_bus_read_reg_with_ret(SPI_FLASH_TR_DONE, &u32Reg))
-                break;
-        }
-        while(u32Reg != 1);
+        spi_flash_wait_tr_done();
 
         /* Disable pinmux to SPI flash to minimize leakage. */
         u32Val &= ~((0x7777ul) << 12);
@@ -323,27 +651,34 @@ int8_t spi_flash_enable(uint8_t enable)
 
 int8_t spi_flash_read(uint8_t *pu8Buf, uint32_t u32offset, uint32_t u32Sz)
 {
-    if(u32Sz > FLASH_BLOCK_SIZE)
+    int8_t s8Ret;
+
+    if(u32Sz > SPI_FLASH_READ_SLOT_SZ)
     {
         do
         {
-            if (M2M_SUCCESS != spi_flash_read_internal(pu8Buf, u32offset, FLASH_BLOCK_SIZE))
-                return M2M_ERR_FAIL;
+            u32Sz     -= SPI_FLASH_READ_SLOT_SZ;
 
-            u32Sz     -= FLASH_BLOCK_SIZE;
-            u32offset += FLASH_BLOCK_SIZE;
-            pu8Buf    += FLASH_BLOCK_SIZE;
+            s8Ret = spi_flash_read_internal(pu8Buf, u32offset, SPI_FLASH_READ_SLOT_SZ,
+                                            (u32Sz > SPI_FLASH_READ_SLOT_SZ) ? SPI_FLASH_READ_SLOT_SZ : u32Sz);
+            if (M2M_SUCCESS != s8Ret)
+                return s8Ret;
+
+            u32offset += SPI_FLASH_READ_SLOT_SZ;
+            pu8Buf    += SPI_FLASH_READ_SLOT_SZ;
         }
-        while(u32Sz > FLASH_BLOCK_SIZE);
+        while(u32Sz > SPI_FLASH_READ_SLOT_SZ);
     }
 
-    return spi_flash_read_internal(pu8Buf, u32offset, u32Sz);
+    /* sequential reads usually continue with blocks of the same size */
+    return spi_flash_read_internal(pu8Buf, u32offset, u32Sz, u32Sz);
 }
 
 int8_t spi_flash_write(uint8_t* pu8Buf, uint32_t u32Offset, uint32_t u32Sz)
 {
     uint_fast16_t u16wsz;
     uint32_t u32off;
+    int8_t s8Ret;
 
     if (u32Sz == 0)
     {
@@ -351,6 +686,9 @@ int8_t spi_flash_write(uint8_t* pu8Buf, uint32_t u32Offset, uint32_t u32Sz)
         return M2M_ERR_FAIL;
     }
 
+    spi_flexible_flash_invalidate(u32Offset, u32Sz);
+    spi_flash_read_ahead_invalidate(u32Offset, u32Sz);
+
     u32off = u32Offset % FLASH_PAGE_SZ;
 
     if (u32off)     /*first part of data in the address page*/
@@ -362,8 +700,9 @@ int8_t spi_flash_write(uint8_t* pu8Buf, uint32_t u32Offset, uint32_t u32Sz)
         if (u16wsz > u32Sz)
             u16wsz = u32Sz;
 
-        if (spi_flash_pp(u32Offset, pu8Buf, u16wsz) != M2M_SUCCESS)
-            return M2M_ERR_FAIL;
+        s8Ret = spi_flash_pp(u32Offset, pu8Buf, u16wsz);
+        if (s8Ret != M2M_SUCCESS)
+            return s8Ret;
 
         pu8Buf    += u16wsz;
         u32Offset += u16wsz;
@@ -377,8 +716,9 @@ int8_t spi_flash_write(uint8_t* pu8Buf, uint32_t u32Offset, uint32_t u32Sz)
             else u16wsz = u32Sz;
 
         /*write complete page or the remaining data*/
-        if (spi_flash_pp(u32Offset, pu8Buf, u16wsz) != M2M_SUCCESS)
-            return M2M_ERR_FAIL;
+        s8Ret = spi_flash_pp(u32Offset, pu8Buf, u16wsz);
+        if (s8Ret != M2M_SUCCESS)
+            return s8Ret;
 
         pu8Buf    += u16wsz;
         u32Offset += u16wsz;
@@ -391,7 +731,17 @@ int8_t spi_flash_write(uint8_t* pu8Buf, uint32_t u32Offset, uint32_t u32Sz)
 int8_t spi_flash_erase(uint32_t u32Offset, uint32_t u32Sz)
 {
     uint32_t i;
+    uint32_t u32StartUs;
     uint8_t u8Reg;
+    int8_t s8Ret;
+
+    s8Ret = spi_flash_complete();
+    if (M2M_SUCCESS != s8Ret)
+        return s8Ret;
+
+    spi_flexible_flash_invalidate(u32Offset, u32Sz);
+    /* the erase is rounded to whole sectors, just drop the read ahead */
+    gbReadAheadValid = false;
 
     WINC_LOG_INFO("\r\n>Start erasing...");
 
@@ -403,21 +753,216 @@ int8_t spi_flash_erase(uint32_t u32Offset, uint32_t u32Sz)
             return M2M_ERR_FAIL;
         if (M2M_SUCCESS != spi_flash_sector_erase(i))
             return M2M_ERR_FAIL;
-        if (M2M_SUCCESS != spi_flash_read_status_reg(&u8Reg))
-            return M2M_ERR_FAIL;
-        do
+
+        u32StartUs = winc_adapter_time_us();
+
+        s8Ret = spi_flash_wait_wip(SPI_FLASH_OP_SECTOR_ERASE, u32StartUs, SPI_FLASH_SE_EXPECTED_US, SPI_FLASH_SE_TIMEOUT_US);
+        if (M2M_SUCCESS != s8Ret)
+            return s8Ret;
+    }
+
+    WINC_LOG_INFO("Done");
+
+    return M2M_SUCCESS;
+}
+
+int8_t spi_flash_erase_start(uint32_t u32Offset)
+{
+    uint8_t u8Reg;
+    int8_t s8Ret;
+
+    s8Ret = spi_flash_complete();
+    if (M2M_SUCCESS != s8Ret)
+        return s8Ret;
+
+    u32Offset -= u32Offset % FLASH_SECTOR_SZ;
+
+    spi_flexible_flash_invalidate(u32Offset, FLASH_SECTOR_SZ);
+    spi_flash_read_ahead_invalidate(u32Offset, FLASH_SECTOR_SZ);
+
+    if (M2M_SUCCESS != spi_flash_write_enable())
+        return M2M_ERR_FAIL;
+    if (M2M_SUCCESS != spi_flash_read_status_reg(&u8Reg))
+        return M2M_ERR_FAIL;
+    if (M2M_SUCCESS != spi_flash_sector_erase(u32Offset))
+        return M2M_ERR_FAIL;
+
+    /* completion is checked before the next flash operation */
+    gu32EraseStartUs = winc_adapter_time_us();
+    gbErasePending = true;
+
+    return M2M_SUCCESS;
+}
+
+int8_t spi_flash_flush(void)
+{
+    return spi_flash_complete();
+}
+
+int8_t spi_flash_snapshot(uint32_t u32Offset, uint32_t u32Sz)
+{
+    int8_t s8Ret;
+
+    if (u32Sz > SPI_FLASH_SNAPSHOT_SZ)
+        return M2M_ERR_INVALID_ARG;
+
+    s8Ret = spi_flash_complete();
+    if (M2M_SUCCESS != s8Ret)
+        return s8Ret;
+
+    return spi_flash_load_to_cortus_mem(SPI_FLASH_SNAPSHOT_MEM_BASE, u32Offset, u32Sz);
+}
+
+int8_t spi_flash_snapshot_read(uint8_t *pu8Buf, uint32_t u32Offset, uint32_t u32Sz)
+{
+    if ((u32Offset + u32Sz) > SPI_FLASH_SNAPSHOT_SZ)
+        return M2M_ERR_INVALID_ARG;
+
+    if (WINC_BUS_SUCCESS != winc_bus_read_block(SPI_FLASH_SNAPSHOT_MEM_BASE + u32Offset, pu8Buf, u32Sz))
+        return M2M_ERR_FAIL;
+
+    return M2M_SUCCESS;
+}
+
+static int8_t spi_flash_tune_check(uint32_t u32ChipId, uint32_t *pu32DurationUs)
+{
+    uint8_t au8Out[SPI_FLASH_TUNE_CHUNK_SZ];
+    uint8_t au8In[SPI_FLASH_TUNE_CHUNK_SZ];
+    uint32_t u32Val;
+    uint32_t u32StartUs;
+    uint_fast16_t u16Offset;
+    uint_fast8_t i;
+
+    /* a register with a known value first, a wrong clock usually breaks the command response */
+    if (WINC_BUS_SUCCESS != winc_bus_read_reg_with_ret(NMI_CHIPID, &u32Val))
+        return M2M_ERR_BUS_FAIL;
+    if (u32Val != u32ChipId)
+        return M2M_ERR_BUS_FAIL;
+
+    /* the staging slots are free once all flash operations have completed */
+    u32StartUs = winc_adapter_time_us();
+    for (u16Offset = 0; u16Offset < FLASH_PAGE_SZ; u16Offset += SPI_FLASH_TUNE_CHUNK_SZ)
+    {
+        /* alternate bit patterns, and a different pattern per chunk to catch addressing errors */
+        for (i = 0; i < SPI_FLASH_TUNE_CHUNK_SZ; i++)
+            au8Out[i] = (uint8_t)(((i & 1) ? 0x5a : 0xa5) ^ (u16Offset + i));
+
+        if (WINC_BUS_SUCCESS != winc_bus_write_block(HOST_SHARE_MEM_BASE + u16Offset, au8Out, SPI_FLASH_TUNE_CHUNK_SZ))
+            return M2M_ERR_BUS_FAIL;
+        if (WINC_BUS_SUCCESS != winc_bus_read_block(HOST_SHARE_MEM_BASE + u16Offset, au8In, SPI_FLASH_TUNE_CHUNK_SZ))
+            return M2M_ERR_BUS_FAIL;
+        if (memcmp(au8Out, au8In, SPI_FLASH_TUNE_CHUNK_SZ))
+            return M2M_ERR_BUS_FAIL;
+    }
+    *pu32DurationUs = winc_adapter_time_us() - u32StartUs;
+
+    return M2M_SUCCESS;
+}
+
+int8_t spi_flash_tune_clock(tstrSpiFlashClock *pstrClock)
+{
+    int8_t s8Ret;
+    uint32_t u32ChipId;
+    uint32_t u32DurationUs;
+    uint32_t u32BestUs;
+    uint_fast8_t u8Best;
+    uint_fast8_t u8Clock;
+
+    s8Ret = spi_flash_complete();
+    if (M2M_SUCCESS != s8Ret)
+        return s8Ret;
+
+    winc_adapter_spi_set_clock(WINC_ADAPTER_SPI_CLOCK_SAFE);
+    if (WINC_BUS_SUCCESS != winc_bus_read_reg_with_ret(NMI_CHIPID, &u32ChipId))
+        return M2M_ERR_BUS_FAIL;
+    if (M2M_SUCCESS != spi_flash_tune_check(u32ChipId, &u32BestUs))
+        return M2M_ERR_BUS_FAIL;
+
+    u8Best = WINC_ADAPTER_SPI_CLOCK_SAFE;
+    for (u8Clock = WINC_ADAPTER_SPI_CLOCK_SAFE + 1; u8Clock < WINC_ADAPTER_SPI_CLOCK_COUNT; u8Clock++)
+    {
+        winc_adapter_spi_set_clock(u8Clock);
+        if (M2M_SUCCESS != spi_flash_tune_check(u32ChipId, &u32DurationUs))
         {
-            if (M2M_SUCCESS != spi_flash_read_status_reg(&u8Reg))
-                return M2M_ERR_FAIL;
+            WINC_LOG_INFO("SPI clock %" PRIu32 " Hz failed", winc_adapter_spi_get_clock_hz());
+
+            /* back to the last good clock, the failure may have left the WINC mid-command */
+            winc_adapter_spi_set_clock(u8Best);
+            if ((WINC_BUS_SUCCESS != winc_bus_reset()) || (M2M_SUCCESS != spi_flash_tune_check(u32ChipId, &u32BestUs)))
+            {
+                u8Best = WINC_ADAPTER_SPI_CLOCK_SAFE;
+                winc_adapter_spi_set_clock(u8Best);
+                winc_bus_reset();
+                if (M2M_SUCCESS != spi_flash_tune_check(u32ChipId, &u32BestUs))
+                    return M2M_ERR_BUS_FAIL;
+            }
+            break;
         }
-        while(u8Reg & 0x01);
+
+        u8Best = u8Clock;
+        u32BestUs = u32DurationUs;
     }
 
-    WINC_LOG_INFO("Done");
+    pstrClock->u32ClockHz = winc_adapter_spi_get_clock_hz();
+    /* a page is written and read back in the measured time */
+    pstrClock->u32BytesPerSec = u32BestUs ? ((2UL * FLASH_PAGE_SZ * 1000000UL) / u32BestUs) : 0;
 
     return M2M_SUCCESS;
 }
 
+void spi_flash_set_verify(bool bEnable)
+{
+    gbVerify = bEnable;
+}
+
+bool spi_flash_reset_pipeline(void)
+{
+    bool bLost = gbProgramPending || gbErasePending;
+
+    gbReadAheadPending = false;
+    gbReadAheadValid = false;
+    /* the staged page and its slot are gone with the shared memory */
+    gbProgramPending = false;
+    gu8StagingSlot = 0;
+    gbErasePending = false;
+
+    return bLost;
+}
+
+int8_t spi_flash_check_ready(void)
+{
+    uint32_t u32ChipId;
+    uint8_t u8Reg;
+
+    /* read the chip ID from the bus, winc_chip_get_id only returns a cached value */
+    if (WINC_BUS_SUCCESS != winc_bus_read_reg_with_ret(NMI_CHIPID, &u32ChipId))
+        return M2M_ERR_BUS_FAIL;
+
+    if ((u32ChipId == 0) || (u32ChipId == 0xffffffff))
+        return M2M_NOT_YET;
+
+    if (M2M_SUCCESS != spi_flash_complete())
+        return M2M_ERR_BUS_FAIL;
+
+    if (M2M_SUCCESS != spi_flash_read_status_reg(&u8Reg))
+        return M2M_ERR_BUS_FAIL;
+
+    if (u8Reg & 0x01)
+        return M2M_NOT_YET;
+
+    return M2M_SUCCESS;
+}
+
+void spi_flash_get_timing(tenuSpiFlashOp enuOp, tstrSpiFlashTiming *pstrTiming)
+{
+    *pstrTiming = gastrTiming[enuOp];
+}
+
+void spi_flash_reset_timing(void)
+{
+    memset(gastrTiming, 0, sizeof(gastrTiming));
+}
+
 uint32_t spi_flash_get_size(void)
 {
     uint32_t u32FlashId;
@@ -426,6 +971,9 @@ uint32_t spi_flash_get_size(void)
     if (gu32InternalFlashSize)
         return gu32InternalFlashSize;
 
+    if (M2M_SUCCESS != spi_flash_complete())
+        return 0;
+
     u32FlashId = spi_flash_rdid();
 
     if(u32FlashId != 0xffffffff)
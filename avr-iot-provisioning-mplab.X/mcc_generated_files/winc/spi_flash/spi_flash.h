@@ -52,6 +52,67 @@
 #ifndef __SPI_FLASH_H__
 #define __SPI_FLASH_H__
 
+/*!
+@brief
+    Returned when a page read back after programming differs from the data written.
+
+@see    spi_flash_set_verify
+*/
+#define SPI_FLASH_ERR_VERIFY        (-16)
+
+/*!
+@brief
+    Returned when a page program or sector erase was still in progress when the WINC was reset, so it is not known
+    whether it completed.
+
+@see    spi_flash_reset_pipeline
+*/
+#define SPI_FLASH_ERR_LOST          (-17)
+
+/*!
+@enum   \
+    tenuSpiFlashOp
+
+@brief
+    SPI flash operations with measured durations.
+
+@see    spi_flash_get_timing
+*/
+typedef enum
+{
+    SPI_FLASH_OP_PAGE_PROGRAM,
+    SPI_FLASH_OP_SECTOR_ERASE,
+    SPI_FLASH_OP_COUNT
+} tenuSpiFlashOp;
+
+/*!
+@struct \
+    tstrSpiFlashTiming
+
+@brief
+    Measured durations of a SPI flash operation. The average is u32TotalUs / u32Count.
+*/
+typedef struct
+{
+    uint32_t u32Count;
+    uint32_t u32MinUs;
+    uint32_t u32MaxUs;
+    uint32_t u32TotalUs;
+} tstrSpiFlashTiming;
+
+/*!
+@struct \
+    tstrSpiFlashClock
+
+@brief
+    SPI clock selected by @ref spi_flash_tune_clock and the throughput measured with it.
+*/
+typedef struct
+{
+    uint32_t u32ClockHz;
+    uint32_t u32BytesPerSec;
+} tstrSpiFlashClock;
+
 /**@addtogroup SPIFLASHFUNCTIONS
  * @{
  */
@@ -96,6 +157,10 @@ uint32_t spi_flash_get_size(void);
 @note
     No firmware is required to be loaded on the WINC for the SPI flash to be accessed.
 
+@note
+    When the read is done the block following it is loaded in the background, a
+    following read of that block only has to transfer it over SPI.
+
 @warning
     The read must not exceed the last address of the flash.
 
@@ -104,6 +169,7 @@ uint32_t spi_flash_get_size(void);
     the SPI flash using @ref m2m_wifi_download_mode.
 
 @see    m2m_wifi_download_mode
+@see    spi_flash_flush
 
 @return
     The function returns @ref M2M_SUCCESS for successful operations and a negative value otherwise.
@@ -140,8 +206,14 @@ int8_t spi_flash_read(uint8_t *pu8Buf, uint32_t u32Addr, uint32_t u32Sz);
     The flash sector should be erased before writing data using the function @ref spi_flash_erase
     otherwise the correct data will not be written.
 
+@note
+    The function returns as soon as the last page has been handed to the flash. Completion
+    of that page is checked by the next SPI flash operation or by @ref spi_flash_flush,
+    a programming error may therefore be reported by the following call.
+
 @see    m2m_wifi_download_mode
 @see    spi_flash_erase
+@see    spi_flash_flush
 
 @return
     The function returns @ref M2M_SUCCESS for successful operations and a negative value otherwise.
@@ -183,6 +255,196 @@ int8_t spi_flash_write(uint8_t* pu8Buf, uint32_t u32Offset, uint32_t u32Sz);
 */
 int8_t spi_flash_erase(uint32_t u32Offset, uint32_t u32Sz);
 
+/*!
+@fn \
+    int8_t spi_flash_erase_start(uint32_t u32Offset);
+
+@brief
+    Start erasing the sector containing u32Offset without waiting for the erase to complete.
+
+@param[in]  u32Offset
+    Address of any byte in the sector to erase.
+
+@note
+    The erase runs in the background until the next SPI flash operation, which waits
+    for it to complete first. Erase errors are reported by that operation.
+
+@warning
+    If the WINC device has running firmware it must be stopped before interacting with
+    the SPI flash using @ref m2m_wifi_download_mode.
+
+@see    spi_flash_erase
+
+@return
+    The function returns @ref M2M_SUCCESS for successful operations and a negative value otherwise.
+*/
+int8_t spi_flash_erase_start(uint32_t u32Offset);
+
+/*!
+@fn \
+    int8_t spi_flash_flush(void);
+
+@brief
+    Wait for any page program started by @ref spi_flash_write, any erase started by
+    @ref spi_flash_erase_start and any read ahead started by @ref spi_flash_read to complete.
+
+@note
+    Must be called before the WINC is reset or leaves download mode so the last page
+    written is not lost.
+
+@see    spi_flash_write
+
+@return
+    The function returns @ref M2M_SUCCESS for successful operations and a negative value otherwise.
+*/
+int8_t spi_flash_flush(void);
+
+/*!
+@fn \
+    int8_t spi_flash_snapshot(uint32_t u32Offset, uint32_t u32Sz);
+
+@brief
+    Copy a range of the SPI flash into WINC memory, so it can be read back with
+    @ref spi_flash_snapshot_read after the flash range has been erased.
+
+@param[in]  u32Offset
+    Address of the first byte of the range.
+
+@param[in]  u32Sz
+    Size of the range, at most one sector (@ref FLASH_SECTOR_SZ).
+
+@note
+    The copy is lost when the WINC is reset, and replaced by the next snapshot.
+
+@return
+    The function returns @ref M2M_SUCCESS for successful operations and a negative value otherwise.
+*/
+int8_t spi_flash_snapshot(uint32_t u32Offset, uint32_t u32Sz);
+
+/*!
+@fn \
+    int8_t spi_flash_snapshot_read(uint8_t *pu8Buf, uint32_t u32Offset, uint32_t u32Sz);
+
+@brief
+    Read from the copy taken by @ref spi_flash_snapshot.
+
+@param[out] pu8Buf
+    Pointer to a data buffer of at least u32Sz bytes.
+
+@param[in]  u32Offset
+    Offset from the start of the copied range.
+
+@param[in]  u32Sz
+    Number of bytes to read.
+
+@return
+    The function returns @ref M2M_SUCCESS for successful operations and a negative value otherwise.
+*/
+int8_t spi_flash_snapshot_read(uint8_t *pu8Buf, uint32_t u32Offset, uint32_t u32Sz);
+
+/*!
+@fn \
+    void spi_flash_set_verify(bool bEnable);
+
+@brief
+    Enable or disable read back verification of programmed pages.
+
+@param[in]  bEnable
+    When true every page is read back and compared with the data written once
+    programming has completed.
+
+@note
+    Like programming errors, a mismatch is reported by the SPI flash operation following
+    the write, or by @ref spi_flash_flush, as @ref SPI_FLASH_ERR_VERIFY.
+
+@see    spi_flash_write
+*/
+void spi_flash_set_verify(bool bEnable);
+
+/*!
+@fn \
+    bool spi_flash_reset_pipeline(void);
+
+@brief
+    Forget about any read ahead, pipelined page program or background erase in progress without waiting for it.
+
+@note
+    Must be called when the WINC is reset since the shared memory content is lost.
+
+@return
+    true if a page program or sector erase was abandoned, its result will never be reported and the affected flash
+    must be treated as unknown.  false if only a read ahead, or nothing, was in progress.
+*/
+bool spi_flash_reset_pipeline(void);
+
+/*!
+@fn \
+    int8_t spi_flash_check_ready(void);
+
+@brief
+    Check that the SPI flash can be accessed, the chip ID must be readable and the flash must not be busy.
+
+@note
+    Used after entering download mode instead of waiting a fixed time.
+
+@return
+    The function returns @ref M2M_SUCCESS when the flash is ready, @ref M2M_NOT_YET if the
+    WINC or flash is still busy and a negative value otherwise.
+*/
+int8_t spi_flash_check_ready(void);
+
+/*!
+@fn \
+    int8_t spi_flash_tune_clock(tstrSpiFlashClock *pstrClock);
+
+@brief
+    Select the fastest SPI clock the WINC link works reliably at.
+
+@details
+    The clock is stepped up from the power-up default. Each setting must read back the chip ID
+    and pass a write and read back of a page of test data through shared memory. The first
+    failing setting ends the search and the last good one is kept.
+
+@param[out] pstrClock
+    Pointer to structure to be filled with the selected clock and the measured throughput.
+
+@warning
+    The WINC must be in download mode, the test data overwrites the page program staging area.
+
+@return
+    The function returns @ref M2M_SUCCESS for successful operations and a negative value otherwise.
+    On failure the power-up default clock is selected.
+*/
+int8_t spi_flash_tune_clock(tstrSpiFlashClock *pstrClock);
+
+/*!
+@fn \
+    void spi_flash_get_timing(tenuSpiFlashOp enuOp, tstrSpiFlashTiming *pstrTiming);
+
+@brief
+    Get the measured durations of a SPI flash operation.
+
+@param[in]  enuOp
+    Operation to get the durations for.
+
+@param[out] pstrTiming
+    Pointer to structure to be filled with the durations.
+
+@note
+    Page programs whose completion is only checked after the expected time has passed are not
+    measured, as their duration can not be told apart from the time spent elsewhere.
+*/
+void spi_flash_get_timing(tenuSpiFlashOp enuOp, tstrSpiFlashTiming *pstrTiming);
+
+/*!
+@fn \
+    void spi_flash_reset_timing(void);
+
+@brief
+    Clear the measured durations of all SPI flash operations.
+*/
+void spi_flash_reset_timing(void);
+
  /**@}*/
 
 #endif  //__SPI_FLASH_H__
@@ -22,23 +22,72 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <stdio.h>
+#include <inttypes.h>
 #include "winc_commands.h"
 #include "mcc_generated_files/winc/spi_flash/spi_flash.h"
 #include "mcc_generated_files/winc/spi_flash/spi_flash_map.h"
+#include "mcc_generated_files/winc/spi_flash/flexible_flash.h"
 #include "mcc_generated_files/winc/m2m/m2m_wifi.h"
 #include "mcc_generated_files/winc/common/winc_defines.h"
 #include "mcc_generated_files/winc/m2m/m2m_fwinfo.h"
+#include "mcc_generated_files/winc/driver/winc_adapter.h"
+#include "mcc_generated_files/winc/driver/winc_spi.h"
 #include "mcc_generated_files/delay.h"
 #include "command_handler/parser/mc_parser.h"
 #include "command_handler/mc_argparser.h"
 #include "command_handler/parser/mc_error.h"
+#include "mcc_generated_files/CryptoAuthenticationLibrary/basic/atca_basic.h"
+#include "mcc_generated_files/CryptoAuthenticationLibrary/crypto/hashes/sha2_routines.h"
+#include "ecc_commands.h"
 #include "conversions.h"
+#include "checksum.h"
+#include "winc_journal.h"
+
+// Upper limit for the WINC to become ready after switching between download mode and normal mode
+#define WINC_MODE_SWITCH_TIMEOUT_MS 250
+
+// Measured time from starting a mode switch until the WINC is ready
+static tstrSpiFlashTiming mode_switch_timing;
+
+// Auto-erase session, one bit per sector erased since the session was started
+static bool autoerase = false;
+static uint32_t autoerase_sectors;
+static uint8_t autoerase_erased[WINC_AUTOERASE_MAX_SECTORS / 8];
+// Erase the next sector in the background when a write reaches the end of a sector
+static bool autoerase_ahead_enabled = false;
+
+// Read back and compare every programmed page
+static bool verify = false;
 
 // Helpers
 static uint16_t parse_and_check_write_args(uint8_t argc, char *argv[], uint32_t *address_parsed, uint16_t *length_parsed);
 static uint16_t parse_and_check_read_args(uint8_t argc, char *argv[], uint32_t *address_parsed, uint16_t *length_parsed);
 static uint16_t parse_and_check_erase_args(uint8_t argc, char *argv[], uint32_t *address_parsed);
+static uint16_t parse_and_check_sectormap_args(uint8_t argc, char *argv[], uint32_t *address_parsed, uint16_t *count_parsed);
 static uint16_t parse_and_check_common_args(uint8_t argc, char *argv[], uint8_t num_args, uint32_t *address_parsed, uint16_t *length_parsed);
+static bool rle_check_stream(const uint8_t *stream, uint16_t stream_length, uint16_t expected_length);
+static int8_t rle_decompress_and_write(const uint8_t *stream, uint16_t stream_length, uint32_t address, uint8_t *page);
+static int8_t write_page_buffer(uint8_t *page, uint32_t address, uint16_t length);
+static bool page_is_erased(const uint8_t *page, uint16_t length);
+static int8_t program_flash(uint8_t *data, uint32_t address, uint16_t length);
+static int8_t autoerase_prepare(uint32_t address, uint16_t length);
+static void autoerase_mark(uint32_t sector);
+static int8_t autoerase_ahead(uint32_t end_address);
+static int8_t journal_progress(uint32_t end_address);
+static uint16_t write_status(int8_t m2m_status);
+static uint16_t flash_status(int8_t m2m_status);
+static uint16_t rootcert_entry_size(const uint8_t *entry_header);
+static int8_t rootcert_scan(const uint8_t *name_hash, uint32_t *count, uint16_t *store_end, uint16_t *match_offset, uint16_t *match_size);
+static int8_t rootcert_rewrite(uint32_t count, const uint8_t *entry, uint16_t entry_length, uint16_t keep_end, uint16_t keep_start, uint16_t store_end, uint8_t *page);
+static int8_t rootcert_emit(const uint8_t *source, uint16_t snapshot_offset, uint16_t length, uint32_t *address, uint16_t *fill, uint8_t *page);
+static int8_t rootcert_write_page(uint8_t *page, uint32_t address, uint16_t length);
+static uint16_t parse_and_check_copy_args(uint8_t argc, char *argv[], uint32_t *source_parsed, uint32_t *destination_parsed, uint32_t *length_parsed);
+static uint16_t parse_and_check_fill_args(uint8_t argc, char *argv[], uint32_t *address_parsed, uint32_t *length_parsed, uint8_t *value_parsed);
+static uint16_t check_flash_range(uint32_t address, uint32_t length);
+static uint16_t parse_and_check_readstream_args(uint8_t argc, char *argv[], uint32_t *address_parsed, uint32_t *length_parsed);
+static uint16_t print_timing(char *buffer, uint16_t buffer_length, const char *name, const tstrSpiFlashTiming *timing);
+static int8_t wait_for_winc_ready(bool download);
 
 uint16_t winc_init(void) {
     // Initialize WINC stack
@@ -50,6 +99,10 @@ uint16_t winc_init(void) {
 /*
  * Write data blob (max one page) to WINC flash
  *
+ * The page is programmed while the host sends the next command, so unless verify mode is on an OK response only means
+ * that programming has started.  The same goes for the other write commands.  If the page fails, the next command
+ * accessing the WINC flash, or leaving download mode, returns the error instead of doing its own work.
+ *
  * Parameters:
  *  argc: number of items in the argv parameter
  *  argv: command arguments, this command expects argv to contain two arguments:
@@ -97,8 +150,326 @@ uint16_t cmd_winc_writeblob(uint8_t argc, char *argv[], uint8_t *data, uint16_t
     // This function never returns any data so data_length should be set to 0
     *data_length = 0;
 
-    winc_download_mode(true);
-	m2m_status = spi_flash_write(data, address, length);
+    cmd_status = winc_download_mode(true);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+    // Checked before anything is erased by an auto-erase session
+    cmd_status = check_flash_range(address, length);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+    m2m_status = program_flash(data, address, length);
+    if (m2m_status == M2M_SUCCESS) {
+        m2m_status = journal_progress(address + length);
+    }
+    if (m2m_status == M2M_SUCCESS) {
+        m2m_status = autoerase_ahead(address + length);
+    }
+
+    return write_status(m2m_status);
+}
+
+/*
+ * Write a run-length encoded data blob to WINC flash
+ *
+ * WINC images contain long runs of 0xFF and padding, compressing them reduces the number of bytes sent over the UART.
+ * See winc_commands.h for the stream format.  The stream is decompressed into page sized chunks which are written to
+ * flash as soon as they are complete.  Pages containing only 0xFF are skipped as programming them would not change
+ * the flash contents.
+ *
+ * Parameters:
+ *  argc: number of items in the argv parameter
+ *  argv: command arguments, this command expects argv to contain three arguments:
+ *      destination: address/offset to start writing at
+ *      length: number of bytes to write after decompression.  Should be non-zero
+ *      bloblength: number of hex encoded bytes in the compressed stream
+ *  data: pointer to a buffer of MC_DATA_BUFFER_LENGTH bytes containing the hex encoded compressed stream.
+ *      The last page of the buffer is used for decompression so there will not be any data to return
+ *  data_length: pointer to variable with number of bytes of actual data in the data buffer.  This parameter is a
+ *      pointer so that the command implementation can modify it to tell the caller how much data is returned through
+ *      the buffer pointed to by the data parameter.  For this instance there will not be any data to return so the
+ *      value pointed to by data_length will always be set to 0
+ */
+uint16_t cmd_winc_writecompressed(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length)
+{
+    uint16_t cmd_status;
+    int8_t m2m_status = M2M_SUCCESS;
+    uint32_t address = 0;
+    uint16_t length = 0;
+    uint16_t stream_length;
+
+    if (!check_pointers(data, data_length)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // Check that arguments are valid
+    if (argc != WINC_WRITE_NUM_ARGS) {
+        *data_length = 0;
+        return MC_STATUS_BAD_ARGUMENT_COUNT;
+    }
+    if (!argv ||
+        !parse_arg_uint32(argv[WINC_READ_WRITE_ARG_ADDRESS], &address) ||
+        !parse_arg_uint16(argv[WINC_READ_WRITE_ARG_LENGTH], &length) ||
+        length == 0) {
+        *data_length = 0;
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // The compressed stream is hex encoded so it must contain an even number of bytes.  The parser delivers at most
+    // MC_DATA_BUFFER_LENGTH hex encoded bytes, so after conversion the stream fits in the first half of the data buffer
+    // and never overlaps the page buffer at the end of it
+    if (*data_length == 0 || (*data_length % 2) != 0) {
+        *data_length = 0;
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // Same in-place conversion as for the write command
+    stream_length = convert_hex2bin(*data_length, data, data);
+
+    // This function never returns any data so data_length should be set to 0
+    *data_length = 0;
+
+    // Check the complete stream before writing anything so that a corrupt stream doesn't leave a partially written
+    // range behind
+    if (!rle_check_stream(data, stream_length, length)) {
+        return MC_STATUS_BAD_BLOB;
+    }
+
+    cmd_status = winc_download_mode(true);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+    // Checked before anything is erased by an auto-erase session
+    cmd_status = check_flash_range(address, length);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+    m2m_status = rle_decompress_and_write(data, stream_length, address, data + MC_DATA_BUFFER_LENGTH - FLASH_PAGE_SZ);
+
+    return write_status(m2m_status);
+}
+
+// Helper that walks through a run-length encoded stream and checks that it is well formed and decompresses to exactly
+// expected_length bytes
+static bool rle_check_stream(const uint8_t *stream, uint16_t stream_length, uint16_t expected_length)
+{
+    uint32_t decompressed_length = 0;
+    uint16_t index = 0;
+
+    while (index < stream_length) {
+        uint8_t token = stream[index++];
+        uint8_t count = (token & WINC_RLE_LENGTH_MASK) + 1;
+
+        if (token & WINC_RLE_RUN_FLAG) {
+            // One byte to repeat
+            index += 1;
+        } else {
+            index += count;
+        }
+
+        if (index > stream_length) {
+            // Token continues past the end of the stream
+            return false;
+        }
+        decompressed_length += count;
+    }
+
+    return decompressed_length == expected_length;
+}
+
+// Helper that decompresses a run-length encoded stream, that has already been checked, into page sized chunks and
+// writes them to WINC flash starting at address
+static int8_t rle_decompress_and_write(const uint8_t *stream, uint16_t stream_length, uint32_t address, uint8_t *page)
+{
+    int8_t m2m_status = M2M_SUCCESS;
+    uint16_t index = 0;
+    // The first chunk ends at the first page boundary after the start address
+    uint16_t page_length = 0;
+    uint16_t page_space = FLASH_PAGE_SZ - (address % FLASH_PAGE_SZ);
+
+    while (index < stream_length) {
+        uint8_t token = stream[index++];
+        uint8_t count = (token & WINC_RLE_LENGTH_MASK) + 1;
+        bool run = (token & WINC_RLE_RUN_FLAG) != 0;
+
+        while (count--) {
+            page[page_length++] = stream[index];
+            if (!run) {
+                index++;
+            }
+
+            if (page_length == page_space) {
+                m2m_status = write_page_buffer(page, address, page_length);
+                if (m2m_status != M2M_SUCCESS) {
+                    return m2m_status;
+                }
+                address += page_length;
+                page_length = 0;
+                page_space = FLASH_PAGE_SZ;
+            }
+        }
+
+        if (run) {
+            index++;
+        }
+    }
+
+    if (page_length) {
+        // Last partial page
+        m2m_status = write_page_buffer(page, address, page_length);
+    }
+
+    return m2m_status;
+}
+
+// Helper that writes a decompressed chunk to WINC flash unless it is all 0xFF.  Programming 0xFF never changes the
+// contents of the flash so these chunks can be skipped, as long as the sector has been erased
+static int8_t write_page_buffer(uint8_t *page, uint32_t address, uint16_t length)
+{
+    int8_t m2m_status;
+
+    if (page_is_erased(page, length)) {
+        m2m_status = autoerase_prepare(address, length);
+    } else {
+        m2m_status = program_flash(page, address, length);
+    }
+    if (m2m_status != M2M_SUCCESS) {
+        return m2m_status;
+    }
+
+    m2m_status = journal_progress(address + length);
+    if (m2m_status != M2M_SUCCESS) {
+        return m2m_status;
+    }
+
+    return autoerase_ahead(address + length);
+}
+
+// Helper that checks if a chunk only contains 0xFF, the value of erased flash
+static bool page_is_erased(const uint8_t *page, uint16_t length)
+{
+    for (uint16_t i = 0; i < length; i++) {
+        if (page[i] != 0xFF) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Helper used by all commands writing to WINC flash
+static int8_t program_flash(uint8_t *data, uint32_t address, uint16_t length)
+{
+    int8_t m2m_status = autoerase_prepare(address, length);
+    if (m2m_status != M2M_SUCCESS) {
+        return m2m_status;
+    }
+
+    return spi_flash_write(data, address, length);
+}
+
+// Helper that erases the sectors of a range that haven't been erased yet in the current auto-erase session.  Does
+// nothing if there is no session
+static int8_t autoerase_prepare(uint32_t address, uint16_t length)
+{
+    int8_t m2m_status;
+    uint32_t last_sector = (address + length - 1) / FLASH_SECTOR_SZ;
+
+    if (!autoerase) {
+        return M2M_SUCCESS;
+    }
+
+    for (uint32_t sector = address / FLASH_SECTOR_SZ; sector <= last_sector; sector++) {
+        if (sector >= autoerase_sectors) {
+            return M2M_ERR_INVALID_ARG;
+        }
+        if (autoerase_erased[sector / 8] & (1 << (sector % 8))) {
+            continue;
+        }
+        m2m_status = spi_flash_erase(sector * FLASH_SECTOR_SZ, FLASH_SECTOR_SZ);
+        if (m2m_status != M2M_SUCCESS) {
+            return m2m_status;
+        }
+        autoerase_mark(sector);
+    }
+
+    return M2M_SUCCESS;
+}
+
+// Helper that records a sector as erased in the current auto-erase session
+static void autoerase_mark(uint32_t sector)
+{
+    if (autoerase && sector < autoerase_sectors) {
+        autoerase_erased[sector / 8] |= (1 << (sector % 8));
+    }
+}
+
+// Helper that starts erasing the next sector in the background when a write reaches the end of a sector in an
+// erase-ahead session.  The host writes sectors in order, so the erase normally runs while the first page of the next
+// sector is sent over the UART, and the program of that page only waits for whatever is left of it
+static int8_t autoerase_ahead(uint32_t end_address)
+{
+    int8_t m2m_status;
+    uint32_t sector = end_address / FLASH_SECTOR_SZ;
+
+    if (!autoerase || !autoerase_ahead_enabled || (end_address % FLASH_SECTOR_SZ) != 0 || sector >= autoerase_sectors) {
+        return M2M_SUCCESS;
+    }
+    if (autoerase_erased[sector / 8] & (1 << (sector % 8))) {
+        return M2M_SUCCESS;
+    }
+
+    m2m_status = spi_flash_erase_start(end_address);
+    if (m2m_status == M2M_SUCCESS) {
+        autoerase_mark(sector);
+    }
+
+    return m2m_status;
+}
+
+// Helper that records a sector in the progress journal when a write reaches the end of it.  The host writes sectors
+// in order so the rest of the sector has already been written.  The last page must have been programmed before it
+// can be recorded
+static int8_t journal_progress(uint32_t end_address)
+{
+    int8_t m2m_status;
+
+    if ((end_address % FLASH_SECTOR_SZ) != 0 || !winc_journal_active()) {
+        return M2M_SUCCESS;
+    }
+
+    m2m_status = spi_flash_flush();
+    if (m2m_status != M2M_SUCCESS) {
+        return m2m_status;
+    }
+
+    winc_journal_add_sector(end_address / FLASH_SECTOR_SZ - 1);
+
+    return M2M_SUCCESS;
+}
+
+// Helper converting the result of a write command to a command status
+// In verify mode the last page programmed by the command is completed and checked before the status is returned, so a
+// page that doesn't read back as written fails the command that wrote it
+static uint16_t write_status(int8_t m2m_status)
+{
+    if (verify && m2m_status == M2M_SUCCESS) {
+        m2m_status = spi_flash_flush();
+    }
+
+    return flash_status(m2m_status);
+}
+
+// Helper converting the result of a WINC flash operation to a command status
+// Page programming is pipelined, so outside verify mode the last page written by a write command is completed by the
+// next flash operation.  A failure of that page is returned by whichever command drains the pipeline, mapped the same
+// way as if the write command had reported it
+static uint16_t flash_status(int8_t m2m_status)
+{
+    if (m2m_status == SPI_FLASH_ERR_VERIFY) {
+        return MC_STATUS_VERIFY_FAILED;
+    }
 
     return STATUS_SOURCE_WINC(m2m_status);
 }
@@ -143,7 +514,10 @@ uint16_t cmd_winc_read(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data
     // same buffer can be used as the target when converting from raw binary to
     // hex encoded data
     uint8_t *data_raw = data+length;
-    winc_download_mode(true);
+    cmd_status = winc_download_mode(true);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
 	m2m_status = spi_flash_read(data_raw, address, length);
 
     if (m2m_status != M2M_SUCCESS) {
@@ -154,7 +528,7 @@ uint16_t cmd_winc_read(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data
         *data_length = convert_bin2hex(length, data_raw, data);
     }
 
-    return STATUS_SOURCE_WINC(m2m_status);
+    return flash_status(m2m_status);
 }
 
 // Helper to check input arguments to WINC read command and returns the parsed address and length arguments through the pointer parameters
@@ -234,10 +608,17 @@ uint16_t cmd_winc_erasesector(uint8_t argc, char *argv[], uint8_t *data, uint16_
         return cmd_status;
     }
 
-    winc_download_mode(true);
+    cmd_status = winc_download_mode(true);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
 	m2m_status = spi_flash_erase(address, FLASH_SECTOR_SZ);
+    if (m2m_status == M2M_SUCCESS) {
+        // No need for auto-erase to erase it again
+        autoerase_mark(address / FLASH_SECTOR_SZ);
+    }
 
-    return STATUS_SOURCE_WINC(m2m_status);
+    return flash_status(m2m_status);
 }
 
 // Helper to check input arguments to WINC erase command and returns the parsed address argument through the pointer parameters
@@ -257,47 +638,1394 @@ static uint16_t parse_and_check_erase_args(uint8_t argc, char *argv[], uint32_t
     return MC_STATUS_OK;
 }
 
-// Set/unset WINC download mode
-uint16_t winc_download_mode(bool set)
+/*
+ * Start or stop an auto-erase session
+ *
+ * During an auto-erase session each sector is erased the first time it is written by the write, copy and fill commands
+ * so the host doesn't have to send MC+WINC+ERASE before writing each sector.  Note that a write to any part of a
+ * sector erases the whole sector.  Starting a new session forgets which sectors were erased in the previous one.
+ *
+ * A session started with AHEAD is meant for hosts writing whole sectors in increasing address order.  When a write
+ * reaches the end of a sector the erase of the next sector is started straight away and runs in the background while
+ * the host sends the next page, so the erase time is mostly hidden.  Note that this erases the sector following the
+ * last sector written even if the host never writes to it.
+ *
+ * Parameters:
+ *  argc: number of items in the argv parameter
+ *  argv: command arguments, this command expects argv to contain one argument:
+ *      mode: ON or AHEAD to start a session, OFF to end it
+ *  data: pointer to a buffer of MC_DATA_BUFFER_LENGTH bytes, not used by this command
+ *  data_length: pointer to variable with number of bytes of actual data in the data buffer.  This parameter is a
+ *      pointer so that the command implementation can modify it to tell the caller how much data is returned through
+ *      the buffer pointed to by the data parameter.  For this instance there will not be any data to return so the
+ *      value pointed to by data_length will always be set to 0
+ */
+uint16_t cmd_winc_autoerase(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length)
 {
-    // WINC module will boot in normal mode (i.e. not download mode)
-    static bool download_mode = false;
-    int8_t m2m_status = M2M_SUCCESS;
+    uint16_t cmd_status;
+    uint32_t flash_size;
 
-    if ((set && download_mode) || (!set && !download_mode)) {
-        // Already in correct mode
-        return STATUS_SOURCE_WINC(M2M_SUCCESS);
+    if (!check_pointers(data, data_length)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
     }
 
-    if (set) {
-        // First check that the WINC isn't already initialized
-        if(WIFI_STATE_DEINIT != m2m_wifi_get_state()) {
-            // WINC is already initialized and must be de-initialized first
-            m2m_wifi_deinit(NULL);
-        }
-        m2m_status = m2m_wifi_download_mode();
-        download_mode = true;
+    // This function never returns any data so data_length should be set to 0
+    *data_length = 0;
+
+    if (argc != WINC_AUTOERASE_NUM_ARGS) {
+        return MC_STATUS_BAD_ARGUMENT_COUNT;
+    }
+    if (!argv) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    if (mc_match_string(WINC_AUTOERASE_OFF, argv[WINC_AUTOERASE_ARG_MODE])) {
+        autoerase = false;
+        return MC_STATUS_OK;
+    }
+    if (mc_match_string(WINC_AUTOERASE_ON, argv[WINC_AUTOERASE_ARG_MODE])) {
+        autoerase_ahead_enabled = false;
+    } else if (mc_match_string(WINC_AUTOERASE_AHEAD, argv[WINC_AUTOERASE_ARG_MODE])) {
+        autoerase_ahead_enabled = true;
     } else {
-        tstrWifiInitParam wifi_parameters;
-        memset((uint8_t*)&wifi_parameters, 0, sizeof(wifi_parameters));
-        m2m_status = m2m_wifi_init(&wifi_parameters);
-        download_mode = false;
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
     }
-    DELAY_milliseconds(250);
-    return STATUS_SOURCE_WINC(m2m_status);
+
+    cmd_status = winc_download_mode(true);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+    // The flash size is reported in megabits
+    flash_size = spi_flash_get_size();
+    if (flash_size == 0) {
+        return STATUS_SOURCE_WINC(M2M_ERR_FAIL);
+    }
+    if (flash_size * (1024UL * 1024UL / 8) / FLASH_SECTOR_SZ > WINC_AUTOERASE_MAX_SECTORS) {
+        return STATUS_SOURCE_WINC(M2M_ERR_INVALID_ARG);
+    }
+
+    autoerase_sectors = flash_size * (1024UL * 1024UL / 8) / FLASH_SECTOR_SZ;
+    memset(autoerase_erased, 0, sizeof(autoerase_erased));
+    autoerase = true;
+
+    return MC_STATUS_OK;
 }
 
 /*
- * Read WINC firmware version
+ * Copy a range of WINC flash to another location in WINC flash
+ *
+ * The data is staged through the data buffer one page at a time so nothing has to pass over the UART.  The chunks are
+ * aligned to the destination pages, and pages containing only 0xFF are skipped like for the compressed write command.
+ * Just like for the write commands the destination must have been erased first, unless an auto-erase session is
+ * active.  For the same reason the source and destination ranges must not overlap.  Both ranges must be within the
+ * WINC flash.
  *
  * Parameters:
- *  version_info: pointer to struct where version info can be returned
+ *  argc: number of items in the argv parameter
+ *  argv: command arguments, this command expects argv to contain three arguments:
+ *      source: address/offset to start copying from
+ *      destination: address/offset to start copying to
+ *      length: number of bytes to copy.  Should be non-zero
+ *  data: pointer to a buffer of MC_DATA_BUFFER_LENGTH bytes, the first page is used for staging the data so there will
+ *      not be any data to return
+ *  data_length: pointer to variable with number of bytes of actual data in the data buffer.  This parameter is a
+ *      pointer so that the command implementation can modify it to tell the caller how much data is returned through
+ *      the buffer pointed to by the data parameter.  For this instance there will not be any data to return so the
+ *      value pointed to by data_length will always be set to 0
  */
-uint16_t read_winc_version(tstrM2mRev *version_info)
+uint16_t cmd_winc_copy(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length)
 {
+    uint16_t cmd_status = MC_STATUS_OK;
     int8_t m2m_status = M2M_SUCCESS;
+    uint32_t source = 0;
+    uint32_t destination = 0;
+    uint32_t length = 0;
+    uint16_t chunk_length;
 
-    winc_download_mode(false);
-	m2m_status = m2m_fwinfo_get_firmware_info(true, version_info);
-	return STATUS_SOURCE_WINC(m2m_status);
+    if (!check_pointers(data, data_length)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // This function never returns any data so data_length should be set to 0
+    *data_length = 0;
+
+    cmd_status = parse_and_check_copy_args(argc, argv, &source, &destination, &length);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+
+    cmd_status = winc_download_mode(true);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+
+    cmd_status = check_flash_range(source, length);
+    if (cmd_status == MC_STATUS_OK) {
+        cmd_status = check_flash_range(destination, length);
+    }
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+
+    // Flash can't be rewritten in place so overlapping ranges can't be copied.  Both ranges are within the flash so
+    // the end addresses can't wrap
+    if (source < destination + length && destination < source + length) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // The first chunk ends at the first page boundary after the destination address
+    chunk_length = FLASH_PAGE_SZ - (destination % FLASH_PAGE_SZ);
+
+    while (length) {
+        if (chunk_length > length) {
+            chunk_length = length;
+        }
+
+        m2m_status = spi_flash_read(data, source, chunk_length);
+        if (m2m_status != M2M_SUCCESS) {
+            break;
+        }
+        m2m_status = write_page_buffer(data, destination, chunk_length);
+        if (m2m_status != M2M_SUCCESS) {
+            break;
+        }
+
+        source += chunk_length;
+        destination += chunk_length;
+        length -= chunk_length;
+        chunk_length = FLASH_PAGE_SZ;
+    }
+
+    return write_status(m2m_status);
+}
+
+// Helper to check input arguments to WINC copy command and returns the parsed arguments through the pointer parameters
+static uint16_t parse_and_check_copy_args(uint8_t argc, char *argv[], uint32_t *source_parsed, uint32_t *destination_parsed, uint32_t *length_parsed)
+{
+    // Check that arguments are valid
+    if (argc != WINC_COPY_NUM_ARGS) {
+        return MC_STATUS_BAD_ARGUMENT_COUNT;
+    }
+    if (!argv) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // parse arguments
+    if (!parse_arg_uint32(argv[WINC_COPY_ARG_SOURCE], source_parsed) ||
+        !parse_arg_uint32(argv[WINC_COPY_ARG_DESTINATION], destination_parsed) ||
+        !parse_arg_uint32(argv[WINC_COPY_ARG_LENGTH], length_parsed)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    if (*length_parsed == 0) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    return MC_STATUS_OK;
+}
+
+/*
+ * Fill a range of WINC flash with one byte value
+ *
+ * A page filled with the value is written over and over so nothing has to pass over the UART.  Programming 0xFF never
+ * changes the flash so filling with 0xFF does not write anything.  Just like for the write commands the range must
+ * have been erased first, unless an auto-erase session is active.  The range must be within the WINC flash.
+ *
+ * Parameters:
+ *  argc: number of items in the argv parameter
+ *  argv: command arguments, this command expects argv to contain three arguments:
+ *      address: address/offset to start filling at
+ *      length: number of bytes to fill.  Should be non-zero
+ *      value: the byte value to fill the range with
+ *  data: pointer to a buffer of MC_DATA_BUFFER_LENGTH bytes, the first page is used for the fill pattern so there
+ *      will not be any data to return
+ *  data_length: pointer to variable with number of bytes of actual data in the data buffer.  This parameter is a
+ *      pointer so that the command implementation can modify it to tell the caller how much data is returned through
+ *      the buffer pointed to by the data parameter.  For this instance there will not be any data to return so the
+ *      value pointed to by data_length will always be set to 0
+ */
+uint16_t cmd_winc_fill(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length)
+{
+    uint16_t cmd_status = MC_STATUS_OK;
+    int8_t m2m_status = M2M_SUCCESS;
+    uint32_t address = 0;
+    uint32_t length = 0;
+    uint8_t value = 0;
+    uint16_t chunk_length;
+
+    if (!check_pointers(data, data_length)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // This function never returns any data so data_length should be set to 0
+    *data_length = 0;
+
+    cmd_status = parse_and_check_fill_args(argc, argv, &address, &length, &value);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+
+    memset(data, value, FLASH_PAGE_SZ);
+
+    cmd_status = winc_download_mode(true);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+
+    cmd_status = check_flash_range(address, length);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+
+    // The first chunk ends at the first page boundary after the start address
+    chunk_length = FLASH_PAGE_SZ - (address % FLASH_PAGE_SZ);
+
+    while (length) {
+        if (chunk_length > length) {
+            chunk_length = length;
+        }
+
+        m2m_status = write_page_buffer(data, address, chunk_length);
+        if (m2m_status != M2M_SUCCESS) {
+            break;
+        }
+
+        address += chunk_length;
+        length -= chunk_length;
+        chunk_length = FLASH_PAGE_SZ;
+    }
+
+    return write_status(m2m_status);
+}
+
+// Helper to check input arguments to WINC fill command and returns the parsed arguments through the pointer parameters
+static uint16_t parse_and_check_fill_args(uint8_t argc, char *argv[], uint32_t *address_parsed, uint32_t *length_parsed, uint8_t *value_parsed)
+{
+    uint16_t value;
+
+    // Check that arguments are valid
+    if (argc != WINC_FILL_NUM_ARGS) {
+        return MC_STATUS_BAD_ARGUMENT_COUNT;
+    }
+    if (!argv) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // parse arguments
+    if (!parse_arg_uint32(argv[WINC_FILL_ARG_ADDRESS], address_parsed) ||
+        !parse_arg_uint32(argv[WINC_FILL_ARG_LENGTH], length_parsed) ||
+        !parse_arg_uint16(argv[WINC_FILL_ARG_VALUE], &value)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    if (*length_parsed == 0 || value > UINT8_MAX) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    *value_parsed = (uint8_t) value;
+
+    return MC_STATUS_OK;
+}
+
+// Helper to check that a range of WINC flash lies within the flash, WINC download mode must already be set.  The end
+// address is never computed so an address or length close to UINT32_MAX can't wrap around and pass the check
+static uint16_t check_flash_range(uint32_t address, uint32_t length)
+{
+    // The flash size is reported in megabits
+    uint32_t flash_size = spi_flash_get_size() * (1024UL * 1024UL / 8);
+
+    if (flash_size == 0) {
+        return STATUS_SOURCE_WINC(M2M_ERR_FAIL);
+    }
+    if (address >= flash_size || length > flash_size - address) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    return MC_STATUS_OK;
+}
+
+/*
+ * Add a root certificate to the WINC TLS root certificate store, or replace the entry with the same subject
+ *
+ * Only the entry itself is sent, see winc_commands.h for the format.  The store is rebuilt in the root certificate
+ * sector one page at a time from a copy of the current store kept in WINC memory, so the other entries don't have to
+ * be sent again.  A replaced entry keeps its position in the store, a new entry is added at the end.  If the sector
+ * doesn't contain a store yet a new one is started.
+ *
+ * The entry is limited to MC_DATA_BUFFER_LENGTH/2 bytes, the largest blob the parser accepts, so RSA-4096 roots can't
+ * be added with this command.
+ *
+ * The update is not atomic: the sector is erased before the new store is written, so if the command fails or the
+ * board is reset part way the store is left empty or truncated and has to be written again.
+ *
+ * Parameters:
+ *  argc: number of items in the argv parameter
+ *  argv: command arguments, this command expects argv to contain two arguments:
+ *      length: number of bytes in the entry, must match the key sizes in the entry header
+ *      bloblength: number of hex encoded bytes
+ *  data: pointer to a buffer of MC_DATA_BUFFER_LENGTH bytes containing the hex encoded entry.  The last page of the
+ *      buffer is used for building the store so there will not be any data to return
+ *  data_length: pointer to variable with number of bytes of actual data in the data buffer.  This parameter is a
+ *      pointer so that the command implementation can modify it to tell the caller how much data is returned through
+ *      the buffer pointed to by the data parameter.  For this instance there will not be any data to return so the
+ *      value pointed to by data_length will always be set to 0
+ */
+uint16_t cmd_winc_rootcert_add(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length)
+{
+    uint16_t cmd_status;
+    int8_t m2m_status;
+    uint16_t length = 0;
+    uint32_t count;
+    uint16_t store_end;
+    uint16_t match_offset;
+    uint16_t match_size;
+
+    if (!check_pointers(data, data_length)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // Check that arguments are valid
+    if (argc != WINC_ROOTCERT_NUM_ARGS) {
+        *data_length = 0;
+        return MC_STATUS_BAD_ARGUMENT_COUNT;
+    }
+    if (!argv || !parse_arg_uint16(argv[WINC_ROOTCERT_ARG_LENGTH], &length) || length == 0) {
+        *data_length = 0;
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+    // The parser delivers at most MC_DATA_BUFFER_LENGTH hex encoded bytes, so the entry is at most half the data buffer
+    // and never overlaps the page buffer at the end of it.  This is enough for RSA keys up to 3072 bits
+    if (*data_length != length*2 || length > MC_DATA_BUFFER_LENGTH / 2) {
+        *data_length = 0;
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // Same in-place conversion as for the write command
+    convert_hex2bin(*data_length, data, data);
+
+    // This function never returns any data so data_length should be set to 0
+    *data_length = 0;
+
+    if (length < WINC_ROOTCERT_ENTRY_HEADER_SIZE || rootcert_entry_size(data) != length) {
+        return MC_STATUS_BAD_BLOB;
+    }
+
+    cmd_status = winc_download_mode(true);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+    m2m_status = spi_flash_snapshot(M2M_TLS_ROOTCER_FLASH_OFFSET, M2M_TLS_ROOTCER_FLASH_SIZE);
+    if (m2m_status != M2M_SUCCESS) {
+        return flash_status(m2m_status);
+    }
+
+    m2m_status = rootcert_scan(data, &count, &store_end, &match_offset, &match_size);
+    if (m2m_status != M2M_SUCCESS) {
+        return flash_status(m2m_status);
+    }
+    if (match_size == 0) {
+        count++;
+    }
+    // Check that the new store fits before erasing the old one
+    if ((uint32_t) store_end - match_size + length > M2M_TLS_ROOTCER_FLASH_SIZE) {
+        return STATUS_SOURCE_WINC(M2M_ERR_INVALID_ARG);
+    }
+
+    m2m_status = rootcert_rewrite(count, data, length, match_offset, match_offset + match_size, store_end,
+                                  data + MC_DATA_BUFFER_LENGTH - FLASH_PAGE_SZ);
+
+    return write_status(m2m_status);
+}
+
+/*
+ * Replace the WINC TLS root certificate store with an empty store
+ *
+ * Parameters:
+ *  argc: number of items in the argv parameter, this command takes no arguments
+ *  argv: command arguments, not used by this command
+ *  data: pointer to a buffer of MC_DATA_BUFFER_LENGTH bytes, the last page is used for building the store
+ *  data_length: pointer to variable with number of bytes of actual data in the data buffer.  This parameter is a
+ *      pointer so that the command implementation can modify it to tell the caller how much data is returned through
+ *      the buffer pointed to by the data parameter.  For this instance there will not be any data to return so the
+ *      value pointed to by data_length will always be set to 0
+ */
+uint16_t cmd_winc_rootcert_clear(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length)
+{
+    uint16_t cmd_status;
+
+    if (!check_pointers(data, data_length)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // This function never returns any data so data_length should be set to 0
+    *data_length = 0;
+
+    if (argc != 0) {
+        return MC_STATUS_BAD_ARGUMENT_COUNT;
+    }
+
+    cmd_status = winc_download_mode(true);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+
+    return write_status(rootcert_rewrite(0, NULL, 0, WINC_ROOTCERT_HEADER_SIZE, WINC_ROOTCERT_HEADER_SIZE,
+                                         WINC_ROOTCERT_HEADER_SIZE, data + MC_DATA_BUFFER_LENGTH - FLASH_PAGE_SZ));
+}
+
+// Helper that returns the total size of a root certificate store entry from its header, or 0 if the key type is
+// unknown
+static uint16_t rootcert_entry_size(const uint8_t *entry_header)
+{
+    const uint8_t *key_info = entry_header + WINC_ROOTCERT_KEY_INFO_OFFSET;
+    uint32_t key_type = entry_header[WINC_ROOTCERT_KEY_TYPE_OFFSET] |
+                        ((uint32_t) entry_header[WINC_ROOTCERT_KEY_TYPE_OFFSET + 1] << 8) |
+                        ((uint32_t) entry_header[WINC_ROOTCERT_KEY_TYPE_OFFSET + 2] << 16) |
+                        ((uint32_t) entry_header[WINC_ROOTCERT_KEY_TYPE_OFFSET + 3] << 24);
+    uint16_t first = key_info[0] | (key_info[1] << 8);
+    uint16_t second = key_info[2] | (key_info[3] << 8);
+    uint32_t size;
+
+    if (key_type == WINC_ROOTCERT_KEY_RSA) {
+        // Modulus size and exponent size, each padded
+        size = (((uint32_t) first + 3) & ~3UL) + (((uint32_t) second + 3) & ~3UL);
+    } else if (key_type == WINC_ROOTCERT_KEY_ECDSA) {
+        // Curve ID and size of each coordinate
+        size = ((2UL * second) + 3) & ~3UL;
+    } else {
+        return 0;
+    }
+
+    size += WINC_ROOTCERT_ENTRY_HEADER_SIZE;
+    if (size > M2M_TLS_ROOTCER_FLASH_SIZE) {
+        return 0;
+    }
+
+    return size;
+}
+
+// Helper that walks through the root certificate store in the snapshot and returns the number of entries, the offset
+// of the end of the last entry and the offset and size of the entry matching name_hash.  If there is no match the
+// returned match offset is the end of the store and the match size is 0.  A sector without a store is reported as an
+// empty store, while a store with entries running past the end of the sector is reported as an error
+static int8_t rootcert_scan(const uint8_t *name_hash, uint32_t *count, uint16_t *store_end, uint16_t *match_offset, uint16_t *match_size)
+{
+    const uint8_t start_pattern[] = WINC_ROOTCERT_START_PATTERN;
+    uint8_t header[WINC_ROOTCERT_ENTRY_HEADER_SIZE];
+    uint16_t offset = WINC_ROOTCERT_HEADER_SIZE;
+    uint16_t entry_size;
+    int8_t m2m_status;
+
+    *count = 0;
+    *store_end = WINC_ROOTCERT_HEADER_SIZE;
+    *match_offset = WINC_ROOTCERT_HEADER_SIZE;
+    *match_size = 0;
+
+    m2m_status = spi_flash_snapshot_read(header, 0, WINC_ROOTCERT_HEADER_SIZE);
+    if (m2m_status != M2M_SUCCESS) {
+        return m2m_status;
+    }
+    if (memcmp(header, start_pattern, WINC_ROOTCERT_START_PATTERN_SIZE) != 0) {
+        return M2M_SUCCESS;
+    }
+    *count = header[16] | ((uint32_t) header[17] << 8) | ((uint32_t) header[18] << 16) | ((uint32_t) header[19] << 24);
+
+    for (uint32_t i = 0; i < *count; i++) {
+        if ((uint32_t) offset + WINC_ROOTCERT_ENTRY_HEADER_SIZE > M2M_TLS_ROOTCER_FLASH_SIZE) {
+            return M2M_ERR_FAIL;
+        }
+        m2m_status = spi_flash_snapshot_read(header, offset, WINC_ROOTCERT_ENTRY_HEADER_SIZE);
+        if (m2m_status != M2M_SUCCESS) {
+            return m2m_status;
+        }
+        entry_size = rootcert_entry_size(header);
+        if (entry_size == 0 || (uint32_t) offset + entry_size > M2M_TLS_ROOTCER_FLASH_SIZE) {
+            return M2M_ERR_FAIL;
+        }
+        if (*match_size == 0 && memcmp(header, name_hash, WINC_ROOTCERT_NAME_HASH_SIZE) == 0) {
+            *match_offset = offset;
+            *match_size = entry_size;
+        }
+        offset += entry_size;
+    }
+
+    *store_end = offset;
+    if (*match_size == 0) {
+        *match_offset = offset;
+    }
+
+    return M2M_SUCCESS;
+}
+
+// Helper that erases the root certificate sector and writes a store with count entries: the entries from the
+// snapshot up to keep_end, the new entry and the entries from keep_start up to store_end.  page must be a buffer of
+// FLASH_PAGE_SZ bytes which doesn't overlap the entry.  Nothing is kept in flash while the store is rewritten, only
+// the snapshot in WINC memory, so a failure after the erase leaves a truncated store behind
+static int8_t rootcert_rewrite(uint32_t count, const uint8_t *entry, uint16_t entry_length, uint16_t keep_end, uint16_t keep_start, uint16_t store_end, uint8_t *page)
+{
+    uint8_t header[WINC_ROOTCERT_HEADER_SIZE] = WINC_ROOTCERT_START_PATTERN;
+    uint32_t address = M2M_TLS_ROOTCER_FLASH_OFFSET;
+    uint16_t fill = 0;
+    int8_t m2m_status;
+
+    header[16] = count & 0xFF;
+    header[17] = (count >> 8) & 0xFF;
+    header[18] = (count >> 16) & 0xFF;
+    header[19] = (count >> 24) & 0xFF;
+
+    m2m_status = spi_flash_erase(M2M_TLS_ROOTCER_FLASH_OFFSET, M2M_TLS_ROOTCER_FLASH_SIZE);
+    if (m2m_status != M2M_SUCCESS) {
+        return m2m_status;
+    }
+    autoerase_mark(M2M_TLS_ROOTCER_FLASH_OFFSET / FLASH_SECTOR_SZ);
+
+    m2m_status = rootcert_emit(header, 0, WINC_ROOTCERT_HEADER_SIZE, &address, &fill, page);
+    if (m2m_status == M2M_SUCCESS) {
+        m2m_status = rootcert_emit(NULL, WINC_ROOTCERT_HEADER_SIZE, keep_end - WINC_ROOTCERT_HEADER_SIZE, &address, &fill, page);
+    }
+    if (m2m_status == M2M_SUCCESS) {
+        m2m_status = rootcert_emit(entry, 0, entry_length, &address, &fill, page);
+    }
+    if (m2m_status == M2M_SUCCESS) {
+        m2m_status = rootcert_emit(NULL, keep_start, store_end - keep_start, &address, &fill, page);
+    }
+    if (m2m_status == M2M_SUCCESS && fill) {
+        // Last partial page, the rest of the sector stays erased
+        m2m_status = rootcert_write_page(page, address, fill);
+    }
+
+    return m2m_status;
+}
+
+// Helper that appends length bytes to the page buffer, from source or from the snapshot if source is NULL.  Full pages
+// are written at address which is then moved to the next page
+static int8_t rootcert_emit(const uint8_t *source, uint16_t snapshot_offset, uint16_t length, uint32_t *address, uint16_t *fill, uint8_t *page)
+{
+    int8_t m2m_status;
+    uint16_t chunk_length;
+
+    while (length) {
+        chunk_length = FLASH_PAGE_SZ - *fill;
+        if (chunk_length > length) {
+            chunk_length = length;
+        }
+
+        if (source) {
+            memcpy(page + *fill, source, chunk_length);
+            source += chunk_length;
+        } else {
+            m2m_status = spi_flash_snapshot_read(page + *fill, snapshot_offset, chunk_length);
+            if (m2m_status != M2M_SUCCESS) {
+                return m2m_status;
+            }
+            snapshot_offset += chunk_length;
+        }
+        *fill += chunk_length;
+        length -= chunk_length;
+
+        if (*fill == FLASH_PAGE_SZ) {
+            m2m_status = rootcert_write_page(page, *address, FLASH_PAGE_SZ);
+            if (m2m_status != M2M_SUCCESS) {
+                return m2m_status;
+            }
+            *address += FLASH_PAGE_SZ;
+            *fill = 0;
+        }
+    }
+
+    return M2M_SUCCESS;
+}
+
+// Helper that writes a page of the rebuilt store.  The sector has just been erased, so pages containing only 0xFF are
+// skipped.  Unlike write_page_buffer the store isn't part of an image written by the host, so it is neither recorded in
+// the journal nor does it start erasing the next sector
+static int8_t rootcert_write_page(uint8_t *page, uint32_t address, uint16_t length)
+{
+    if (page_is_erased(page, length)) {
+        return M2M_SUCCESS;
+    }
+
+    return spi_flash_write(page, address, length);
+}
+
+/*
+ * Calculate a digest for each WINC flash sector in a range
+ *
+ * The host can compare the returned digests with the digests of the image it intends to write and only rewrite the
+ * sectors that differ.
+ *
+ * Parameters:
+ *  argc: number of items in the argv parameter
+ *  argv: command arguments, this command expects argv to contain two arguments:
+ *      address: address of the first sector, must be aligned to a sector boundary
+ *      count: number of sectors.  Should be non-zero and not more than WINC_SECTORMAP_MAX_COUNT
+ *  data: pointer to a buffer of MC_DATA_BUFFER_LENGTH bytes where the digests will be returned.
+ *      Each digest is a CRC-32 of the complete sector, returned as 4 bytes big endian.  The digests are concatenated
+ *      in sector order and the returned data is hex-encoded
+ *  data_length: pointer to variable with number of bytes of actual data in the data buffer.  This parameter is a
+ *      pointer so that the command implementation can modify it to tell the caller how much data is returned through
+ *      the buffer pointed to by the data parameter.
+ */
+uint16_t cmd_winc_sectormap(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length)
+{
+    uint16_t cmd_status = MC_STATUS_OK;
+    int8_t m2m_status = M2M_SUCCESS;
+    uint32_t address = 0;
+    uint16_t count = 0;
+
+    if (!check_pointers(data, data_length)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    cmd_status = parse_and_check_sectormap_args(argc, argv, &address, &count);
+
+    // No data calculated yet so set to 0 in case something is wrong and the function returns before all sectors are done
+    *data_length = 0;
+
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+
+    // The flash is read one page at a time into the end of the data buffer.  The binary digests are collected in the
+    // second half of the space needed for the hex encoded response so that the same buffer can be used as the target
+    // when converting from raw binary to hex encoded data, just like for the read command
+    uint16_t digests_length = count * WINC_SECTORMAP_DIGEST_SIZE;
+    uint8_t *digests = data + digests_length;
+    uint8_t *page = data + MC_DATA_BUFFER_LENGTH - FLASH_PAGE_SZ;
+
+    cmd_status = winc_download_mode(true);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+
+    for (uint16_t sector = 0; sector < count; sector++) {
+        uint32_t crc = 0;
+
+        for (uint32_t offset = 0; offset < FLASH_SECTOR_SZ; offset += FLASH_PAGE_SZ) {
+            m2m_status = spi_flash_read(page, address + offset, FLASH_PAGE_SZ);
+            if (m2m_status != M2M_SUCCESS) {
+                // Something went wrong, can't trust the digests so no data is returned
+                return flash_status(m2m_status);
+            }
+            crc = checksum_crc32(crc, page, FLASH_PAGE_SZ);
+        }
+
+        digests[0] = (uint8_t) (crc >> 24);
+        digests[1] = (uint8_t) (crc >> 16);
+        digests[2] = (uint8_t) (crc >> 8);
+        digests[3] = (uint8_t) crc;
+        digests += WINC_SECTORMAP_DIGEST_SIZE;
+        address += FLASH_SECTOR_SZ;
+    }
+
+    *data_length = convert_bin2hex(digests_length, data + digests_length, data);
+
+    return flash_status(m2m_status);
+}
+
+// Helper to check input arguments to WINC sector map command and returns the parsed address and count arguments through the pointer parameters
+static uint16_t parse_and_check_sectormap_args(uint8_t argc, char *argv[], uint32_t *address_parsed, uint16_t *count_parsed)
+{
+    // Check that arguments are valid
+    if (argc != WINC_SECTORMAP_NUM_ARGS) {
+        return MC_STATUS_BAD_ARGUMENT_COUNT;
+    }
+    if (!argv) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // parse arguments
+    if (!parse_arg_uint32(argv[WINC_SECTORMAP_ARG_ADDRESS], address_parsed) ||
+        !parse_arg_uint16(argv[WINC_SECTORMAP_ARG_COUNT], count_parsed)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // Digests are always calculated over complete sectors
+    if ((*address_parsed % FLASH_SECTOR_SZ) != 0) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    if (*count_parsed > WINC_SECTORMAP_MAX_COUNT || *count_parsed == 0) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    return MC_STATUS_OK;
+}
+
+/*
+ * Read a range of any size from WINC flash
+ *
+ * The data is read in chunks of WINC_READSTREAM_CHUNK_SIZE bytes which are hex encoded and sent to the host while the
+ * command is running, so the response is not limited by the size of the data buffer.  The hex encoded data is
+ * followed by a newline and the hex encoded CRC-32 of the raw data (see checksum.h) which is returned as the normal
+ * response data.
+ *
+ * Parameters:
+ *  argc: number of items in the argv parameter
+ *  argv: command arguments, this command expects argv to contain two arguments:
+ *      source: address/offset to start reading from
+ *      length: number of bytes to read.  Should be non-zero
+ *  data: pointer to a buffer of MC_DATA_BUFFER_LENGTH bytes used for reading and hex encoding each chunk
+ *  data_length: pointer to variable with number of bytes of actual data in the data buffer.  This parameter is a
+ *      pointer so that the command implementation can modify it to tell the caller how much data is returned through
+ *      the buffer pointed to by the data parameter.
+ */
+uint16_t cmd_winc_readstream(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length)
+{
+    uint16_t cmd_status = MC_STATUS_OK;
+    int8_t m2m_status = M2M_SUCCESS;
+    uint32_t address = 0;
+    uint32_t length = 0;
+    uint32_t crc = 0;
+    uint16_t chunk_length;
+    // Raw data goes in the second half of the buffer and is hex encoded into the whole buffer, just like for the read
+    // command
+    uint8_t *chunk = data + WINC_READSTREAM_CHUNK_SIZE;
+
+    if (!check_pointers(data, data_length)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // No data returned until all chunks have been read
+    *data_length = 0;
+
+    cmd_status = parse_and_check_readstream_args(argc, argv, &address, &length);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+
+    cmd_status = winc_download_mode(true);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+    // Checked before the stream is started so that an error is returned before any data
+    cmd_status = check_flash_range(address, length);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+
+    while (length) {
+        chunk_length = (length > WINC_READSTREAM_CHUNK_SIZE) ? WINC_READSTREAM_CHUNK_SIZE : length;
+
+        m2m_status = spi_flash_read(chunk, address, chunk_length);
+        if (m2m_status != M2M_SUCCESS) {
+            // Terminate the partial stream so the status ends up on a line of its own
+            mc_stream_data((const uint8_t*)"\r\n", 2);
+            return flash_status(m2m_status);
+        }
+
+        crc = checksum_crc32(crc, chunk, chunk_length);
+        mc_stream_data(data, convert_bin2hex(chunk_length, chunk, data));
+
+        address += chunk_length;
+        length -= chunk_length;
+    }
+
+    mc_stream_data((const uint8_t*)"\r\n", 2);
+
+    data[WINC_READSTREAM_CHUNK_SIZE] = (uint8_t) (crc >> 24);
+    data[WINC_READSTREAM_CHUNK_SIZE + 1] = (uint8_t) (crc >> 16);
+    data[WINC_READSTREAM_CHUNK_SIZE + 2] = (uint8_t) (crc >> 8);
+    data[WINC_READSTREAM_CHUNK_SIZE + 3] = (uint8_t) crc;
+    *data_length = convert_bin2hex(CHECKSUM_CRC32_SIZE, chunk, data);
+
+    return MC_STATUS_OK;
+}
+
+// Helper to check input arguments to WINC read stream command and returns the parsed address and length arguments
+// through the pointer parameters
+static uint16_t parse_and_check_readstream_args(uint8_t argc, char *argv[], uint32_t *address_parsed, uint32_t *length_parsed)
+{
+    // Check that arguments are valid
+    if (argc != WINC_READSTREAM_NUM_ARGS) {
+        return MC_STATUS_BAD_ARGUMENT_COUNT;
+    }
+    if (!argv) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // parse arguments
+    if (!parse_arg_uint32(argv[WINC_READSTREAM_ARG_ADDRESS], address_parsed) ||
+        !parse_arg_uint32(argv[WINC_READSTREAM_ARG_LENGTH], length_parsed)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    if (*length_parsed == 0) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    return MC_STATUS_OK;
+}
+
+/*
+ * Compute a SHA-256 digest of a range of WINC flash and sign it with the device key
+ *
+ * The range is hashed on the MCU so nothing but the result has to be sent over the UART.  The signature can be checked
+ * with the device certificate, so the response is a record of exactly what the board holds.
+ *
+ * Parameters:
+ *  argc: number of items in the argv parameter
+ *  argv: command arguments, this command expects argv to contain two arguments:
+ *      address: address/offset of the first byte of the range
+ *      length: number of bytes to hash, should be non-zero
+ *  data: pointer to a buffer of MC_DATA_BUFFER_LENGTH bytes where the hex encoded digest followed by the hex encoded
+ *      signature will be returned
+ *  data_length: pointer to variable with number of bytes of actual data in the data buffer.  This parameter is a
+ *      pointer so that the command implementation can modify it to tell the caller how much data is returned through
+ *      the buffer pointed to by the data parameter.
+ */
+uint16_t cmd_winc_attest(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length)
+{
+    uint16_t cmd_status = MC_STATUS_OK;
+    int8_t m2m_status = M2M_SUCCESS;
+    uint8_t atca_status;
+    uint32_t address = 0;
+    uint32_t length = 0;
+    uint16_t chunk_length;
+    sw_sha256_ctx sha256;
+    // The binary digest and signature go in the second half of the buffer and are hex encoded into the whole buffer
+    uint8_t *digest = data + MC_DATA_BUFFER_LENGTH / 2;
+
+    if (!check_pointers(data, data_length)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // This function only returns data on success
+    *data_length = 0;
+
+    cmd_status = parse_and_check_readstream_args(argc, argv, &address, &length);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+
+    cmd_status = winc_download_mode(true);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+    cmd_status = check_flash_range(address, length);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+
+    sw_sha256_init(&sha256);
+    while (length) {
+        chunk_length = (length > MC_DATA_BUFFER_LENGTH) ? MC_DATA_BUFFER_LENGTH : length;
+
+        m2m_status = spi_flash_read(data, address, chunk_length);
+        if (m2m_status != M2M_SUCCESS) {
+            return flash_status(m2m_status);
+        }
+        sw_sha256_update(&sha256, data, chunk_length);
+
+        address += chunk_length;
+        length -= chunk_length;
+    }
+    sw_sha256_final(&sha256, digest);
+
+    atca_status = atcab_sign(DEVICE_PRIVATE_KEY_SLOT, digest, digest + WINC_ATTEST_DIGEST_SIZE);
+    if (atca_status != ATCA_SUCCESS) {
+        return STATUS_SOURCE_CRYPTOAUTHLIB(atca_status);
+    }
+
+    *data_length = convert_bin2hex(WINC_ATTEST_DIGEST_SIZE + WINC_ATTEST_SIGNATURE_SIZE, digest, data);
+
+    return MC_STATUS_OK;
+}
+
+/*
+ * Read the WINC flash map
+ *
+ * One line is returned per flash map entry on the format <id>,<offset>,<size> with offset and size in bytes.  The
+ * flash map is cached by the WINC driver so repeated calls do not read the flash again unless it has been modified.
+ *
+ * Parameters:
+ *  argc: number of items in the argv parameter, this command does not take any arguments
+ *  argv: command arguments, not used
+ *  data: pointer to a buffer of MC_DATA_BUFFER_LENGTH bytes where the flash map will be returned
+ *  data_length: pointer to variable with number of bytes of actual data in the data buffer.  This parameter is a
+ *      pointer so that the command implementation can modify it to tell the caller how much data is returned through
+ *      the buffer pointed to by the data parameter.
+ */
+uint16_t cmd_winc_flashmap(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length)
+{
+    uint16_t cmd_status;
+    int8_t m2m_status;
+    uint8_t entries;
+    uint16_t id;
+    uint32_t offset;
+    uint32_t size;
+
+    if (!check_pointers(data, data_length)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // This function only returns data on success
+    *data_length = 0;
+
+    if (argc != 0) {
+        return MC_STATUS_BAD_ARGUMENT_COUNT;
+    }
+
+    cmd_status = winc_download_mode(true);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+    m2m_status = spi_flexible_flash_get_num_entries(&entries);
+    if (m2m_status != M2M_SUCCESS) {
+        return flash_status(m2m_status);
+    }
+
+    for (uint8_t entry = 0; entry < entries; entry++) {
+        m2m_status = spi_flexible_flash_get_entry(entry, &id, &offset, &size);
+        if (m2m_status != M2M_SUCCESS) {
+            *data_length = 0;
+            return flash_status(m2m_status);
+        }
+        *data_length += snprintf((char*)data + *data_length, MC_DATA_BUFFER_LENGTH - *data_length,
+                                 "%u,%" PRIu32 ",%" PRIu32 "\r\n", id, offset, size);
+    }
+
+    return MC_STATUS_OK;
+}
+
+/*
+ * Read the version of the WINC firmware in flash
+ *
+ * The version is read from the control sector in download mode, so unlike MC+VERSION=WINC this command doesn't boot
+ * the WINC firmware.  The response has the same format as the MC+VERSION=WINC response.
+ *
+ * Parameters:
+ *  argc: number of items in the argv parameter
+ *  argv: command arguments, this command expects argv to contain one argument:
+ *      image: MAIN for the image the WINC boots from, OTA for the other image
+ *  data: pointer to a buffer of MC_DATA_BUFFER_LENGTH bytes where the version will be returned
+ *  data_length: pointer to variable with number of bytes of actual data in the data buffer.  This parameter is a
+ *      pointer so that the command implementation can modify it to tell the caller how much data is returned through
+ *      the buffer pointed to by the data parameter.
+ */
+uint16_t cmd_winc_fwversion(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length)
+{
+    uint16_t status;
+    bool main_image;
+    tstrM2mRev version_info;
+
+    if (!check_pointers(data, data_length)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // This function only returns data on success
+    *data_length = 0;
+
+    if (argc != WINC_FWVERSION_NUM_ARGS) {
+        return MC_STATUS_BAD_ARGUMENT_COUNT;
+    }
+    if (!argv) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    if (mc_match_string(WINC_FWVERSION_MAIN, argv[WINC_FWVERSION_ARG_IMAGE])) {
+        main_image = true;
+    } else if (mc_match_string(WINC_FWVERSION_OTA, argv[WINC_FWVERSION_ARG_IMAGE])) {
+        main_image = false;
+    } else {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    status = read_winc_flash_version(main_image, &version_info);
+    if (status != MC_STATUS_OK) {
+        return status;
+    }
+
+    *data_length = snprintf((char *) data, MC_DATA_BUFFER_LENGTH,
+                            "WINC firmware %d.%d.%d\r\nWINC driver %d.%d.%d\r\n",
+                            version_info.u8FirmwareMajor,
+                            version_info.u8FirmwareMinor,
+                            version_info.u8FirmwarePatch,
+                            version_info.u8DriverMajor,
+                            version_info.u8DriverMinor,
+                            version_info.u8DriverPatch);
+
+    return MC_STATUS_OK;
+}
+
+/*
+ * Report measured durations of WINC flash operations
+ *
+ * One line is returned per operation on the format <name>,<count>,<min>,<avg>,<max> with all durations in
+ * microseconds.  The values can be used to tune the flash polling and the size of pipelined writes.
+ *
+ * Parameters:
+ *  argc: number of items in the argv parameter
+ *  argv: command arguments, this command takes one optional argument:
+ *      RESET: clear the measurements after reporting them
+ *  data: pointer to a buffer of MC_DATA_BUFFER_LENGTH bytes where the report will be returned
+ *  data_length: pointer to variable with number of bytes of actual data in the data buffer.  This parameter is a
+ *      pointer so that the command implementation can modify it to tell the caller how much data is returned through
+ *      the buffer pointed to by the data parameter.
+ */
+uint16_t cmd_winc_timing(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length)
+{
+    tstrSpiFlashTiming timing;
+    bool reset = false;
+
+    if (!check_pointers(data, data_length)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // This function only returns data on success
+    *data_length = 0;
+
+    if (argc > WINC_TIMING_NUM_ARGS) {
+        return MC_STATUS_BAD_ARGUMENT_COUNT;
+    }
+
+    if (argc == WINC_TIMING_NUM_ARGS) {
+        if (!mc_match_string(WINC_TIMING_RESET, argv[WINC_TIMING_ARG_RESET])) {
+            return MC_STATUS_BAD_ARGUMENT_VALUE;
+        }
+        reset = true;
+    }
+
+    spi_flash_get_timing(SPI_FLASH_OP_PAGE_PROGRAM, &timing);
+    *data_length += print_timing((char*)data + *data_length, MC_DATA_BUFFER_LENGTH - *data_length, "PAGEPROGRAM", &timing);
+    spi_flash_get_timing(SPI_FLASH_OP_SECTOR_ERASE, &timing);
+    *data_length += print_timing((char*)data + *data_length, MC_DATA_BUFFER_LENGTH - *data_length, "SECTORERASE", &timing);
+    *data_length += print_timing((char*)data + *data_length, MC_DATA_BUFFER_LENGTH - *data_length, "MODESWITCH", &mode_switch_timing);
+
+    if (reset) {
+        spi_flash_reset_timing();
+        memset(&mode_switch_timing, 0, sizeof(mode_switch_timing));
+    }
+
+    return MC_STATUS_OK;
+}
+
+/*
+ * Select the fastest reliable SPI clock for the WINC
+ *
+ * The SPI clock is stepped up from the power-up default and each setting is checked by reading the WINC chip ID and
+ * by writing and reading back a page of test data.  The fastest setting passing the checks is kept until the next
+ * reset of the AVR.  The selected clock and the throughput measured with it are returned on the format
+ * "SPI clock <Hz> Hz\r\nThroughput <bytes/s> bytes/s\r\n".
+ *
+ * Parameters:
+ *  argc: number of items in the argv parameter, this command does not take any arguments
+ *  argv: command arguments, not used
+ *  data: pointer to a buffer of MC_DATA_BUFFER_LENGTH bytes where the result will be returned
+ *  data_length: pointer to variable with number of bytes of actual data in the data buffer.  This parameter is a
+ *      pointer so that the command implementation can modify it to tell the caller how much data is returned through
+ *      the buffer pointed to by the data parameter.
+ */
+uint16_t cmd_winc_spitune(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length)
+{
+    uint16_t cmd_status;
+    int8_t m2m_status;
+    tstrSpiFlashClock clock;
+
+    if (!check_pointers(data, data_length)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // This function only returns data on success
+    *data_length = 0;
+
+    if (argc != 0) {
+        return MC_STATUS_BAD_ARGUMENT_COUNT;
+    }
+
+    // The test data is written to WINC memory only used in download mode
+    cmd_status = winc_download_mode(true);
+    if (cmd_status != MC_STATUS_OK) {
+        return cmd_status;
+    }
+    m2m_status = spi_flash_tune_clock(&clock);
+    if (m2m_status != M2M_SUCCESS) {
+        return flash_status(m2m_status);
+    }
+
+    *data_length = snprintf((char *) data, MC_DATA_BUFFER_LENGTH,
+                            "SPI clock %" PRIu32 " Hz\r\nThroughput %" PRIu32 " bytes/s\r\n",
+                            clock.u32ClockHz, clock.u32BytesPerSec);
+
+    return MC_STATUS_OK;
+}
+
+/*
+ * Enable or disable read back verification of written pages
+ *
+ * In verify mode every page programmed by the write, compressed write, copy and fill commands is read back from the
+ * WINC flash once programming has completed and compared with the data written.  A mismatch fails the command with
+ * MC_STATUS_VERIFY_FAILED.  Verification costs one extra page read per page written, and each write command waits for
+ * its last page to complete instead of overlapping it with the next command.
+ *
+ * Parameters:
+ *  argc: number of items in the argv parameter
+ *  argv: command arguments, this command expects argv to contain one argument:
+ *      mode: ON to enable verification, OFF to disable it
+ *  data: pointer to a buffer of MC_DATA_BUFFER_LENGTH bytes, not used by this command
+ *  data_length: pointer to variable with number of bytes of actual data in the data buffer.  This parameter is a
+ *      pointer so that the command implementation can modify it to tell the caller how much data is returned through
+ *      the buffer pointed to by the data parameter.  For this instance there will not be any data to return so the
+ *      value pointed to by data_length will always be set to 0
+ */
+uint16_t cmd_winc_verify(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length)
+{
+    if (!check_pointers(data, data_length)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // This function never returns any data so data_length should be set to 0
+    *data_length = 0;
+
+    if (argc != WINC_VERIFY_NUM_ARGS) {
+        return MC_STATUS_BAD_ARGUMENT_COUNT;
+    }
+    if (!argv) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    if (mc_match_string(WINC_VERIFY_ON, argv[WINC_VERIFY_ARG_MODE])) {
+        verify = true;
+    } else if (mc_match_string(WINC_VERIFY_OFF, argv[WINC_VERIFY_ARG_MODE])) {
+        verify = false;
+    } else {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    spi_flash_set_verify(verify);
+
+    return MC_STATUS_OK;
+}
+
+/*
+ * Query and control the WINC programming progress journal
+ *
+ * The journal lets the host continue an interrupted programming run instead of starting over.  Once a session has
+ * been started every sector completed by the write, copy and fill commands is recorded, see winc_journal.h.
+ *
+ * Without arguments the current session is reported:
+ *  SESSION,<id>
+ *  DIGEST,<hex encoded digest>
+ *  RANGE,<address>,<length>   one line per range of completed sectors
+ * Nothing is returned if there is no session.
+ *
+ * Parameters:
+ *  argc: number of items in the argv parameter
+ *  argv: command arguments, this command takes no arguments to report the session, or:
+ *      START,<id>,<digest>: start a new session.  The digest is WINC_JOURNAL_DIGEST_SIZE hex encoded bytes
+ *      CLEAR: end the session
+ *  data: pointer to a buffer of MC_DATA_BUFFER_LENGTH bytes where the report will be returned
+ *  data_length: pointer to variable with number of bytes of actual data in the data buffer.  This parameter is a
+ *      pointer so that the command implementation can modify it to tell the caller how much data is returned through
+ *      the buffer pointed to by the data parameter.
+ */
+uint16_t cmd_winc_resume(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length)
+{
+    uint32_t session_id;
+    winc_journal_range_t range;
+    // The digest is decoded into the end of the data buffer, well clear of the report
+    uint8_t *digest = data + MC_DATA_BUFFER_LENGTH - WINC_JOURNAL_DIGEST_SIZE;
+
+    if (!check_pointers(data, data_length)) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    // This function only returns data on success
+    *data_length = 0;
+
+    if (argc && !argv) {
+        return MC_STATUS_BAD_ARGUMENT_VALUE;
+    }
+
+    if (argc == 1) {
+        if (!mc_match_string(WINC_RESUME_CLEAR, argv[WINC_RESUME_ARG_ACTION])) {
+            return MC_STATUS_BAD_ARGUMENT_VALUE;
+        }
+        winc_journal_clear();
+        return MC_STATUS_OK;
+    }
+
+    if (argc == WINC_RESUME_NUM_ARGS) {
+        if (!mc_match_string(WINC_RESUME_START, argv[WINC_RESUME_ARG_ACTION]) ||
+            !parse_arg_uint32(argv[WINC_RESUME_ARG_SESSION], &session_id) ||
+            strlen(argv[WINC_RESUME_ARG_DIGEST]) != WINC_JOURNAL_DIGEST_SIZE*2) {
+            return MC_STATUS_BAD_ARGUMENT_VALUE;
+        }
+        convert_hex2bin(WINC_JOURNAL_DIGEST_SIZE*2, (uint8_t*)argv[WINC_RESUME_ARG_DIGEST], digest);
+        winc_journal_start(session_id, digest);
+        return MC_STATUS_OK;
+    }
+
+    if (argc != 0) {
+        return MC_STATUS_BAD_ARGUMENT_COUNT;
+    }
+
+    if (!winc_journal_get_session(&session_id, digest)) {
+        // No session, nothing to resume
+        return MC_STATUS_OK;
+    }
+
+    *data_length += snprintf((char*)data, MC_DATA_BUFFER_LENGTH, "SESSION,%" PRIu32 "\r\nDIGEST,", session_id);
+    *data_length += convert_bin2hex(WINC_JOURNAL_DIGEST_SIZE, digest, data + *data_length);
+    *data_length += snprintf((char*)data + *data_length, MC_DATA_BUFFER_LENGTH - *data_length, "\r\n");
+
+    for (uint8_t index = 0; winc_journal_get_range(index, &range); index++) {
+        *data_length += snprintf((char*)data + *data_length, MC_DATA_BUFFER_LENGTH - *data_length,
+                                 "RANGE,%" PRIu32 ",%" PRIu32 "\r\n",
+                                 (uint32_t)(range.first_sector * FLASH_SECTOR_SZ), (uint32_t)(range.sector_count * FLASH_SECTOR_SZ));
+    }
+
+    return MC_STATUS_OK;
+}
+
+// Print one line of the MC+WINC+TIMING report, returns the number of characters added to the buffer
+static uint16_t print_timing(char *buffer, uint16_t buffer_length, const char *name, const tstrSpiFlashTiming *timing)
+{
+    uint32_t average = 0;
+
+    if (timing->u32Count) {
+        average = timing->u32TotalUs / timing->u32Count;
+    }
+
+    return snprintf(buffer, buffer_length, "%s,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 "\r\n",
+                    name, timing->u32Count, timing->u32MinUs, average, timing->u32MaxUs);
+}
+
+// Set/unset WINC download mode
+uint16_t winc_download_mode(bool set)
+{
+    // WINC module will boot in normal mode (i.e. not download mode)
+    static bool download_mode = false;
+    int8_t m2m_status = M2M_SUCCESS;
+    uint32_t start_us;
+    uint32_t duration_us;
+    bool flash_work_lost = false;
+
+    if (set && download_mode && winc_bus_error()) {
+        // A bus error latched by an earlier command fails every WINC access.  Resync the bus, and if the WINC has
+        // stopped responding restart download mode rather than failing until the board is reset
+        if (winc_bus_recover() != WINC_BUS_SUCCESS) {
+            download_mode = false;
+            // The restart resets the WINC, a page or erase the host has already been told about may not have landed
+            flash_work_lost = spi_flash_reset_pipeline();
+        }
+    }
+
+    if ((set && download_mode) || (!set && !download_mode)) {
+        // Already in correct mode
+        return STATUS_SOURCE_WINC(M2M_SUCCESS);
+    }
+
+    start_us = winc_adapter_time_us();
+
+    if (set) {
+        // First check that the WINC isn't already initialized
+        if(WIFI_STATE_DEINIT != m2m_wifi_get_state()) {
+            // WINC is already initialized and must be de-initialized first
+            m2m_wifi_deinit(NULL);
+        }
+        m2m_status = m2m_wifi_download_mode();
+        download_mode = true;
+    } else {
+        tstrWifiInitParam wifi_parameters;
+        // Flash writes are pipelined, the last page must finish programming before the WINC is restarted.  Its result
+        // is only known now, so a failure is reported here and download mode is kept for the host to deal with it
+        m2m_status = spi_flash_flush();
+        if (m2m_status != M2M_SUCCESS) {
+            return flash_status(m2m_status);
+        }
+        memset((uint8_t*)&wifi_parameters, 0, sizeof(wifi_parameters));
+        m2m_status = m2m_wifi_init(&wifi_parameters);
+        download_mode = false;
+    }
+
+    if (m2m_status == M2M_SUCCESS) {
+        m2m_status = wait_for_winc_ready(set);
+    }
+
+    if (m2m_status == M2M_SUCCESS) {
+        duration_us = winc_adapter_time_us() - start_us;
+        if (!mode_switch_timing.u32Count || duration_us < mode_switch_timing.u32MinUs) {
+            mode_switch_timing.u32MinUs = duration_us;
+        }
+        if (duration_us > mode_switch_timing.u32MaxUs) {
+            mode_switch_timing.u32MaxUs = duration_us;
+        }
+        mode_switch_timing.u32TotalUs += duration_us;
+        mode_switch_timing.u32Count++;
+    }
+
+    if (m2m_status == M2M_SUCCESS && flash_work_lost) {
+        // Download mode is up again, but the command must fail so the host rechecks the flash it last wrote or erased
+        return STATUS_SOURCE_WINC(SPI_FLASH_ERR_LOST);
+    }
+
+    return STATUS_SOURCE_WINC(m2m_status);
+}
+
+// Poll until the WINC is ready after a mode switch, or give up after WINC_MODE_SWITCH_TIMEOUT_MS
+static int8_t wait_for_winc_ready(bool download)
+{
+    int8_t m2m_status;
+    uint16_t timeout = WINC_MODE_SWITCH_TIMEOUT_MS;
+
+    while (true) {
+        if (download) {
+            // Chip ID readable and flash not busy
+            m2m_status = spi_flash_check_ready();
+        } else {
+            // The WINC driver only enters the started state when the firmware has reported that it has booted
+            m2m_status = (WIFI_STATE_START == m2m_wifi_get_state()) ? M2M_SUCCESS : M2M_NOT_YET;
+        }
+
+        if (m2m_status != M2M_NOT_YET) {
+            return m2m_status;
+        }
+
+        if (timeout-- == 0) {
+            return M2M_ERR_TIME_OUT;
+        }
+        DELAY_milliseconds(1);
+    }
+}
+
+/*
+ * Read WINC firmware version
+ *
+ * Parameters:
+ *  version_info: pointer to struct where version info can be returned
+ */
+uint16_t read_winc_version(tstrM2mRev *version_info)
+{
+    uint16_t status;
+    int8_t m2m_status = M2M_SUCCESS;
+
+    // Leaving download mode completes the last page written, if that fails the WINC is still in download mode and its
+    // firmware isn't running
+    status = winc_download_mode(false);
+    if (status != MC_STATUS_OK) {
+        return status;
+    }
+
+	m2m_status = m2m_fwinfo_get_firmware_info(true, version_info);
+	return STATUS_SOURCE_WINC(m2m_status);
+}
+
+/*
+ * Read WINC firmware version from flash without booting the WINC
+ *
+ * Only the firmware and driver version numbers are returned, see m2m_fwinfo_get_flash_info
+ *
+ * Parameters:
+ *  main_image: true for the image the WINC boots from, false for the OTA image
+ *  version_info: pointer to struct where version info can be returned
+ */
+uint16_t read_winc_flash_version(bool main_image, tstrM2mRev *version_info)
+{
+    uint16_t status = winc_download_mode(true);
+    if (status != MC_STATUS_OK) {
+        return status;
+    }
+
+    return STATUS_SOURCE_WINC(m2m_fwinfo_get_flash_info(main_image, version_info));
 }
@@ -26,6 +26,8 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "mcc_generated_files/winc/m2m/m2m_types.h"
+#include "mcc_generated_files/winc/spi_flash/spi_flash_map.h"
+#include "command_handler/parser/mc_parser.h"
 
 enum winc_read_write_args{
     WINC_READ_WRITE_ARG_ADDRESS = 0,
@@ -39,10 +41,18 @@ enum winc_read_write_args{
 
 #define WINC_READ_NUM_ARGS WINC_WRITE_ARG_BLOB_LENGTH
 
+// The compressed write command takes the same arguments as the write command, but the length argument is the number
+// of bytes after decompression.  The data blob is a hex encoded run-length encoded stream made of tokens:
+//  0x00-0x7F: literal, the following (token+1) bytes are copied as is
+//  0x80-0xFF: run, the following byte is repeated ((token&0x7F)+1) times
+#define WINC_RLE_RUN_FLAG    0x80
+#define WINC_RLE_LENGTH_MASK 0x7F
+
 uint16_t winc_init(void);
 uint16_t winc_download_mode(bool set);
 
 uint16_t cmd_winc_writeblob(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+uint16_t cmd_winc_writecompressed(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
 uint16_t cmd_winc_read(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
 
 enum winc_erase_args{
@@ -52,6 +62,145 @@ enum winc_erase_args{
 
 uint16_t cmd_winc_erasesector(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
 
+enum winc_autoerase_args{
+    WINC_AUTOERASE_ARG_MODE = 0,
+    WINC_AUTOERASE_NUM_ARGS
+};
+
+#define WINC_AUTOERASE_ON    "ON"
+#define WINC_AUTOERASE_OFF   "OFF"
+#define WINC_AUTOERASE_AHEAD "AHEAD"
+// Largest flash supported by auto-erase (16 Mbit), erased sectors are tracked with one bit of RAM each
+#define WINC_AUTOERASE_MAX_SECTORS 512
+
+uint16_t cmd_winc_autoerase(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+
+enum winc_copy_args{
+    WINC_COPY_ARG_SOURCE = 0,
+    WINC_COPY_ARG_DESTINATION,
+    WINC_COPY_ARG_LENGTH,
+    WINC_COPY_NUM_ARGS
+};
+
+uint16_t cmd_winc_copy(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+
+enum winc_fill_args{
+    WINC_FILL_ARG_ADDRESS = 0,
+    WINC_FILL_ARG_LENGTH,
+    WINC_FILL_ARG_VALUE,
+    WINC_FILL_NUM_ARGS
+};
+
+uint16_t cmd_winc_fill(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+
+enum winc_sectormap_args{
+    WINC_SECTORMAP_ARG_ADDRESS = 0,
+    WINC_SECTORMAP_ARG_COUNT,
+    WINC_SECTORMAP_NUM_ARGS
+};
+
+// Each sector digest is a CRC-32, returned hex encoded
+#define WINC_SECTORMAP_DIGEST_SIZE 4
+// The response must fit in the data buffer together with one page used for reading the flash
+#define WINC_SECTORMAP_MAX_COUNT ((MC_DATA_BUFFER_LENGTH - FLASH_PAGE_SZ) / (WINC_SECTORMAP_DIGEST_SIZE * 2))
+
+uint16_t cmd_winc_sectormap(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+
+enum winc_readstream_args{
+    WINC_READSTREAM_ARG_ADDRESS = 0,
+    WINC_READSTREAM_ARG_LENGTH,
+    WINC_READSTREAM_NUM_ARGS
+};
+
+// The stream is read in chunks of half the data buffer so that each chunk can be hex encoded in place
+#define WINC_READSTREAM_CHUNK_SIZE (MC_DATA_BUFFER_LENGTH / 2)
+
+uint16_t cmd_winc_readstream(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+
+// The attest command takes the same address and length arguments as the stream read command and returns the hex
+// encoded SHA-256 digest of the range followed by the hex encoded signature of the digest
+#define WINC_ATTEST_DIGEST_SIZE 32
+#define WINC_ATTEST_SIGNATURE_SIZE 64
+
+uint16_t cmd_winc_attest(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+
+uint16_t cmd_winc_flashmap(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+
+enum winc_fwversion_args{
+    WINC_FWVERSION_ARG_IMAGE = 0,
+    WINC_FWVERSION_NUM_ARGS
+};
+
+#define WINC_FWVERSION_MAIN "MAIN"
+#define WINC_FWVERSION_OTA  "OTA"
+
+uint16_t cmd_winc_fwversion(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+
+enum winc_timing_args{
+    WINC_TIMING_ARG_RESET = 0,
+    WINC_TIMING_NUM_ARGS
+};
+
+#define WINC_TIMING_RESET "RESET"
+
+uint16_t cmd_winc_timing(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+
+uint16_t cmd_winc_spitune(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+
+enum winc_verify_args{
+    WINC_VERIFY_ARG_MODE = 0,
+    WINC_VERIFY_NUM_ARGS
+};
+
+#define WINC_VERIFY_ON  "ON"
+#define WINC_VERIFY_OFF "OFF"
+
+uint16_t cmd_winc_verify(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+
+enum winc_rootcert_args{
+    WINC_ROOTCERT_ARG_LENGTH = 0,
+    // The blob length is not needed for the same reason as for the write command
+    WINC_ROOTCERT_ARG_BLOB_LENGTH,
+    WINC_ROOTCERT_NUM_ARGS
+};
+
+// The TLS root certificate store fills the M2M_TLS_ROOTCER_FLASH_OFFSET sector, the unused tail is left erased.  All
+// multi-byte values are little endian.
+//  Store header: 16 byte start pattern followed by the 32-bit number of entries
+//  Entry header:
+//      0-19: SHA1 hash of the subject name, identifies the root
+//      20-35: validity start and expiry dates
+//      36-39: public key type, WINC_ROOTCERT_KEY_RSA or WINC_ROOTCERT_KEY_ECDSA
+//      40-43: RSA: 16-bit modulus size and 16-bit exponent size, ECDSA: 16-bit curve ID and 16-bit key size
+//  The entry header is followed by the public key, for RSA the modulus and the exponent each padded to a multiple of
+//  4 bytes, for ECDSA the X and Y coordinates of key size bytes each, padded to a multiple of 4 bytes
+#define WINC_ROOTCERT_START_PATTERN {0x11, 0xF1, 0x12, 0xF2, 0x13, 0xF3, 0x14, 0xF4, \
+                                     0x15, 0xF5, 0x16, 0xF6, 0x17, 0xF7, 0x18, 0xF8}
+#define WINC_ROOTCERT_START_PATTERN_SIZE 16
+#define WINC_ROOTCERT_HEADER_SIZE (WINC_ROOTCERT_START_PATTERN_SIZE + 4)
+#define WINC_ROOTCERT_ENTRY_HEADER_SIZE 44
+#define WINC_ROOTCERT_NAME_HASH_SIZE 20
+#define WINC_ROOTCERT_KEY_TYPE_OFFSET 36
+#define WINC_ROOTCERT_KEY_INFO_OFFSET 40
+#define WINC_ROOTCERT_KEY_RSA 1
+#define WINC_ROOTCERT_KEY_ECDSA 2
+
+uint16_t cmd_winc_rootcert_add(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+uint16_t cmd_winc_rootcert_clear(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+
+enum winc_resume_args{
+    WINC_RESUME_ARG_ACTION = 0,
+    WINC_RESUME_ARG_SESSION,
+    WINC_RESUME_ARG_DIGEST,
+    WINC_RESUME_NUM_ARGS
+};
+
+#define WINC_RESUME_START "START"
+#define WINC_RESUME_CLEAR "CLEAR"
+
+uint16_t cmd_winc_resume(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+
 uint16_t read_winc_version(tstrM2mRev *version_info);
+uint16_t read_winc_flash_version(bool main_image, tstrM2mRev *version_info);
 
 #endif // WINC_COMMANDS_H
@@ -0,0 +1,262 @@
+/*
+ *  (c) 2021 Microchip Technology Inc. and its subsidiaries.
+ *
+ *  Subject to your compliance with these terms, you may use Microchip software
+ *  and any derivatives exclusively with Microchip products. You’re responsible
+ *  for complying with 3rd party license terms applicable to your use of 3rd
+ *  party software (including open source software) that may accompany
+ *  Microchip software.
+ *
+ *  SOFTWARE IS “AS IS.” NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+ *  APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF
+ *  NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *  IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ *  INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ *  WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ *  BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+ *  FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL LIABILITY ON ALL CLAIMS
+ *  RELATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID
+ *  DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include <avr/eeprom.h>
+#include "winc_journal.h"
+#include "checksum.h"
+
+typedef struct {
+    // Incremented for every store, the valid copy with the latest sequence number holds the current state
+    uint16_t sequence;
+    uint32_t session_id;
+    uint8_t digest[WINC_JOURNAL_DIGEST_SIZE];
+    uint8_t range_count;
+    winc_journal_range_t ranges[WINC_JOURNAL_MAX_RANGES];
+    // CRC-32 of all the fields above, a blank or partially written journal is treated as no session
+    uint32_t crc;
+} winc_journal_t;
+
+// Two copies are written in turn so a write torn by a reset or power loss leaves the previous state in the other copy
+#define WINC_JOURNAL_COPIES 2
+
+static winc_journal_t EEMEM journal_eeprom[WINC_JOURNAL_COPIES];
+
+// RAM copy of the journal, loaded from EEPROM the first time it is needed
+static winc_journal_t journal;
+static bool journal_loaded = false;
+static bool journal_valid = false;
+// EEPROM copy the RAM copy was last loaded from or stored to, the next store goes to the other one
+static uint8_t journal_copy = 0;
+
+static void journal_load(void);
+static bool journal_read_copy(uint8_t copy, winc_journal_t *destination);
+static void journal_store(void);
+
+/**
+ * \brief Starts a new session
+ *
+ * \param[in] session_id   ID chosen by the host
+ * \param[in] digest       WINC_JOURNAL_DIGEST_SIZE bytes identifying the image being written
+ */
+void winc_journal_start(uint32_t session_id, const uint8_t *digest)
+{
+    uint16_t sequence;
+
+    // Keep counting from the stored state so the new session is written over the older copy
+    journal_load();
+    sequence = journal.sequence;
+
+    memset(&journal, 0, sizeof(journal));
+    journal.sequence = sequence;
+    journal.session_id = session_id;
+    memcpy(journal.digest, digest, WINC_JOURNAL_DIGEST_SIZE);
+
+    journal_store();
+}
+
+/**
+ * \brief Ends the current session
+ */
+void winc_journal_clear(void)
+{
+    winc_journal_t stored;
+
+    if (!winc_journal_active()) {
+        return;
+    }
+    journal_valid = false;
+
+    // Corrupting the checksums is enough, no need to wear out the rest of the EEPROM.  The older copy goes first so a
+    // reset in between leaves the current state rather than bringing back older progress.  A copy that is already
+    // invalid is left alone, inverting its checksum again could make it valid
+    for (uint8_t i = 1; i <= WINC_JOURNAL_COPIES; i++) {
+        uint8_t copy = (journal_copy + i) % WINC_JOURNAL_COPIES;
+        if (journal_read_copy(copy, &stored)) {
+            eeprom_update_dword(&journal_eeprom[copy].crc, ~stored.crc);
+        }
+    }
+}
+
+/**
+ * \brief Checks if a session is in progress
+ *
+ * \return    true if a session has been started and not cleared
+ */
+bool winc_journal_active(void)
+{
+    journal_load();
+
+    return journal_valid;
+}
+
+/**
+ * \brief Gets the ID and digest of the current session
+ *
+ * \param[out] session_id   ID of the session
+ * \param[out] digest       Buffer of WINC_JOURNAL_DIGEST_SIZE bytes for the digest
+ *
+ * \return    false if no session is in progress
+ */
+bool winc_journal_get_session(uint32_t *session_id, uint8_t *digest)
+{
+    if (!winc_journal_active()) {
+        return false;
+    }
+
+    *session_id = journal.session_id;
+    memcpy(digest, journal.digest, WINC_JOURNAL_DIGEST_SIZE);
+
+    return true;
+}
+
+/**
+ * \brief Gets a range of completed sectors
+ *
+ * \param[in]  index   Index of the range, starting at 0
+ * \param[out] range   The range
+ *
+ * \return    false if there is no session or index is beyond the last range
+ */
+bool winc_journal_get_range(uint8_t index, winc_journal_range_t *range)
+{
+    if (!winc_journal_active() || index >= journal.range_count) {
+        return false;
+    }
+
+    *range = journal.ranges[index];
+
+    return true;
+}
+
+/**
+ * \brief Records a completely written sector
+ *
+ * Sectors are normally written in order so the sector will usually just extend the last range
+ *
+ * \param[in] sector   Sector number (address / FLASH_SECTOR_SZ)
+ *
+ * \return    false if there is no session or there was no room for the sector
+ */
+bool winc_journal_add_sector(uint16_t sector)
+{
+    winc_journal_range_t *range;
+
+    if (!winc_journal_active()) {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < journal.range_count; i++) {
+        range = &journal.ranges[i];
+
+        if (sector >= range->first_sector && sector < range->first_sector + range->sector_count) {
+            // Already recorded
+            return true;
+        }
+        if (sector == range->first_sector + range->sector_count) {
+            range->sector_count++;
+            // Join with the following range if the gap has been filled
+            if (i + 1 < journal.range_count && journal.ranges[i + 1].first_sector == sector + 1) {
+                range->sector_count += journal.ranges[i + 1].sector_count;
+                memmove(&journal.ranges[i + 1], &journal.ranges[i + 2], (journal.range_count - i - 2) * sizeof(winc_journal_range_t));
+                journal.range_count--;
+            }
+            journal_store();
+            return true;
+        }
+        if (sector + 1 == range->first_sector) {
+            range->first_sector = sector;
+            range->sector_count++;
+            journal_store();
+            return true;
+        }
+        if (sector < range->first_sector) {
+            // Goes in front of this range
+            break;
+        }
+    }
+
+    if (journal.range_count == WINC_JOURNAL_MAX_RANGES) {
+        return false;
+    }
+
+    // Insert a new range, keeping the ranges sorted
+    uint8_t index = 0;
+    while (index < journal.range_count && journal.ranges[index].first_sector < sector) {
+        index++;
+    }
+    memmove(&journal.ranges[index + 1], &journal.ranges[index], (journal.range_count - index) * sizeof(winc_journal_range_t));
+    journal.ranges[index].first_sector = sector;
+    journal.ranges[index].sector_count = 1;
+    journal.range_count++;
+
+    journal_store();
+
+    return true;
+}
+
+// Helper that loads the journal from EEPROM the first time it is needed.  The intact copy with the latest sequence
+// number is used, if neither copy is intact there is no session
+static void journal_load(void)
+{
+    winc_journal_t other;
+    bool other_valid;
+
+    if (journal_loaded) {
+        return;
+    }
+    journal_loaded = true;
+
+    journal_copy = 0;
+    journal_valid = journal_read_copy(0, &journal);
+    other_valid = journal_read_copy(1, &other);
+
+    // The sequence number wraps, the difference tells which copy is newer
+    if (other_valid && (!journal_valid || (int16_t) (other.sequence - journal.sequence) > 0)) {
+        journal = other;
+        journal_copy = 1;
+        journal_valid = true;
+    }
+}
+
+// Helper that reads one EEPROM copy of the journal and checks that it is intact
+static bool journal_read_copy(uint8_t copy, winc_journal_t *destination)
+{
+    eeprom_read_block(destination, &journal_eeprom[copy], sizeof(winc_journal_t));
+
+    return (destination->range_count <= WINC_JOURNAL_MAX_RANGES) &&
+        (destination->crc == checksum_crc32(0, (const uint8_t *) destination, offsetof(winc_journal_t, crc)));
+}
+
+// Helper that updates the sequence number and checksum and writes the journal over the older EEPROM copy, the newer
+// one is only replaced once this write has completed.  Only bytes that have changed are written to limit EEPROM wear,
+// which for a sector being added is just a few bytes
+static void journal_store(void)
+{
+    journal.sequence++;
+    journal.crc = checksum_crc32(0, (const uint8_t *) &journal, offsetof(winc_journal_t, crc));
+    journal_valid = true;
+
+    journal_copy = (journal_copy + 1) % WINC_JOURNAL_COPIES;
+    eeprom_update_block(&journal, &journal_eeprom[journal_copy], sizeof(journal));
+}
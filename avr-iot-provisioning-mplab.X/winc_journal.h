@@ -0,0 +1,60 @@
+/*
+ *  (c) 2021 Microchip Technology Inc. and its subsidiaries.
+ *
+ *  Subject to your compliance with these terms, you may use Microchip software
+ *  and any derivatives exclusively with Microchip products. You’re responsible
+ *  for complying with 3rd party license terms applicable to your use of 3rd
+ *  party software (including open source software) that may accompany
+ *  Microchip software.
+ *
+ *  SOFTWARE IS “AS IS.” NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+ *  APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF
+ *  NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *  IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ *  INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ *  WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ *  BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+ *  FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL LIABILITY ON ALL CLAIMS
+ *  RELATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID
+ *  DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ */
+
+#ifndef WINC_JOURNAL_H_
+#define WINC_JOURNAL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Progress journal for WINC programming sessions.
+//
+// The journal is kept in AVR EEPROM so it survives resets and lost connections.  A session is identified by a host
+// chosen ID and the digest of the image being written.  Completed sectors are recorded as ranges so the host can ask
+// where to continue after an interrupted run.  Two copies are written in turn, so a reset while the journal is being
+// written only loses the sector being recorded.
+
+// Size of the image digest stored with the session, the content is chosen by the host (e.g. SHA-256 of the image)
+#define WINC_JOURNAL_DIGEST_SIZE 32
+// Maximum number of separate ranges of completed sectors, adjacent sectors are merged into one range
+#define WINC_JOURNAL_MAX_RANGES 8
+
+typedef struct {
+    uint16_t first_sector;
+    uint16_t sector_count;
+} winc_journal_range_t;
+
+// Start a new session, any previous progress is forgotten
+void winc_journal_start(uint32_t session_id, const uint8_t *digest);
+// End the current session
+void winc_journal_clear(void);
+// Check if a session is in progress
+bool winc_journal_active(void);
+// Get the ID and digest of the current session, returns false if no session is in progress
+bool winc_journal_get_session(uint32_t *session_id, uint8_t *digest);
+// Get one of the ranges of completed sectors, returns false if index is beyond the last range
+bool winc_journal_get_range(uint8_t index, winc_journal_range_t *range);
+// Record that a sector has been completely written.  Returns false if the sector could not be recorded because all
+// ranges are in use, the host will then have to rewrite it after an interruption
+bool winc_journal_add_sector(uint16_t sector);
+
+#endif /* WINC_JOURNAL_H_ */
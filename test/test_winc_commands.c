@@ -22,13 +22,20 @@
 
 #ifdef TEST
 
+#include <string.h>
 #include "unity.h"
 
 // Mocking out drivers/libs
 #include "mock_spi_flash.h"
+#include "mock_flexible_flash.h"
 #include "mock_delay.h"
 #include "mock_m2m_wifi.h"
 #include "mock_m2m_fwinfo.h"
+#include "mock_mc_parser.h"
+#include "mock_winc_adapter.h"
+#include "mock_winc_journal.h"
+#include "mock_winc_spi.h"
+#include "mock_atca_basic.h"
 
 #include "conversions.h"
 #include "winc_commands.h"
@@ -36,25 +43,46 @@
 #include "winc_defines.h"
 #include "spi_flash_map.h"
 #include "mc_argparser.h"
+#include "checksum.h"
+#include "sha2_routines.h"
 
 #define STATUS_M2M_ERR_FAIL M2M_ERR_FAIL
 // STATUS_SOURCE_WINC = 2, M2M_ERR_FAIL = -12 = 0xF4
 #define STATUS_MC_M2M_ERR_FAIL 0x02F4
+// Size in bytes of a 4 Mbit flash, spi_flash_get_size() reports 4
+#define WINC_FLASH_4M_SIZE (4UL * 1024UL * 1024UL / 8)
 
 
 // Buffers for command arguments
 static uint8_t arg_address[32];
 static uint8_t arg_data_length[32];
 static uint8_t arg_blob_length[32];
+static uint8_t arg_count[32];
+static uint8_t arg_source[32];
+static uint8_t arg_value[32];
 
 void setUp(void)
 {
     // Just ignore all delays in all tests. They are not important for the tested functionality
     DELAY_milliseconds_Ignore();
 
+    // Flushing pending flash writes when leaving download mode is not important for the tested functionality
+    spi_flash_flush_IgnoreAndReturn(M2M_SUCCESS);
+
+    // Mode switch timing is not important for most tests
+    winc_adapter_time_us_IgnoreAndReturn(0);
+
+    // Most tests run without a programming session in progress
+    winc_journal_active_IgnoreAndReturn(false);
+
+    // Most tests run without WINC bus errors
+    winc_bus_error_IgnoreAndReturn(false);
+
     // Make sure WINC stack is in a known state before running any tests
     m2m_wifi_init_IgnoreAndReturn(0);
+    m2m_wifi_get_state_IgnoreAndReturn(WIFI_STATE_START);
     winc_download_mode(false);
+    m2m_wifi_get_state_StopIgnore();
     m2m_wifi_init_StopIgnore();
 }
 
@@ -99,6 +127,75 @@ static void populate_erase_argv(char *argv[], uint32_t address)
     argv[WINC_ERASE_ARG_ADDRESS] = arg_address;
 }
 
+// Helper that populates argv for sector map command with provided address and count values
+static void populate_sectormap_argv(char *argv[], uint32_t address, uint16_t count)
+{
+    snprintf(arg_address, sizeof(arg_address), "%d", address);
+    snprintf(arg_count, sizeof(arg_count), "%d", count);
+    argv[WINC_SECTORMAP_ARG_ADDRESS] = arg_address;
+    argv[WINC_SECTORMAP_ARG_COUNT] = arg_count;
+}
+
+static void populate_readstream_argv(char *argv[], uint32_t address, uint32_t length)
+{
+    snprintf(arg_address, sizeof(arg_address), "%d", address);
+    snprintf(arg_data_length, sizeof(arg_data_length), "%d", length);
+    argv[WINC_READSTREAM_ARG_ADDRESS] = arg_address;
+    argv[WINC_READSTREAM_ARG_LENGTH] = arg_data_length;
+}
+
+// Collects everything streamed by the command under test
+static uint8_t streamed[2*FLASH_PAGE_SZ*4];
+static uint16_t streamed_length;
+
+static void capture_stream(const uint8_t *data, uint16_t length, int num_calls)
+{
+    TEST_ASSERT_LESS_OR_EQUAL_UINT16_MESSAGE(sizeof(streamed) - streamed_length, length, "Streamed too much data");
+    memcpy(streamed + streamed_length, data, length);
+    streamed_length += length;
+}
+
+static void populate_copy_argv(char *argv[], uint32_t source, uint32_t destination, uint32_t length)
+{
+    snprintf(arg_source, sizeof(arg_source), "%lu", (unsigned long) source);
+    snprintf(arg_address, sizeof(arg_address), "%lu", (unsigned long) destination);
+    snprintf(arg_data_length, sizeof(arg_data_length), "%lu", (unsigned long) length);
+    argv[WINC_COPY_ARG_SOURCE] = arg_source;
+    argv[WINC_COPY_ARG_DESTINATION] = arg_address;
+    argv[WINC_COPY_ARG_LENGTH] = arg_data_length;
+}
+
+static void populate_fill_argv(char *argv[], uint32_t address, uint32_t length, uint16_t value)
+{
+    snprintf(arg_address, sizeof(arg_address), "%lu", (unsigned long) address);
+    snprintf(arg_data_length, sizeof(arg_data_length), "%lu", (unsigned long) length);
+    snprintf(arg_value, sizeof(arg_value), "%u", value);
+    argv[WINC_FILL_ARG_ADDRESS] = arg_address;
+    argv[WINC_FILL_ARG_LENGTH] = arg_data_length;
+    argv[WINC_FILL_ARG_VALUE] = arg_value;
+}
+
+// Helper that populates argv for root certificate add command with provided entry length
+static void populate_rootcert_argv(char *argv[], uint16_t length)
+{
+    snprintf(arg_data_length, sizeof(arg_data_length), "%u", length);
+    snprintf(arg_blob_length, sizeof(arg_blob_length), "%u", length*2);
+    argv[WINC_ROOTCERT_ARG_LENGTH] = arg_data_length;
+    argv[WINC_ROOTCERT_ARG_BLOB_LENGTH] = arg_blob_length;
+}
+
+// Helper that generates a root certificate store entry with a P-256 ECDSA key, 44 byte header and 64 byte key
+#define ROOTCERT_ECDSA_ENTRY_SIZE (WINC_ROOTCERT_ENTRY_HEADER_SIZE + 64)
+static void generate_rootcert_entry(uint8_t *entry, uint8_t name)
+{
+    memset(entry, name, ROOTCERT_ECDSA_ENTRY_SIZE);
+    memset(entry + WINC_ROOTCERT_KEY_TYPE_OFFSET, 0, 8);
+    entry[WINC_ROOTCERT_KEY_TYPE_OFFSET] = WINC_ROOTCERT_KEY_ECDSA;
+    // Curve ID 3, key size 32
+    entry[WINC_ROOTCERT_KEY_INFO_OFFSET] = 3;
+    entry[WINC_ROOTCERT_KEY_INFO_OFFSET + 2] = 32;
+}
+
 // Helper that configures mocks for a spi_flash_write
 static void configure_mock_spi_flash_write(uint8_t *data, uint16_t address, uint16_t data_length, int8_t m2m_status)
 {
@@ -107,6 +204,9 @@ static void configure_mock_spi_flash_write(uint8_t *data, uint16_t address, uint
     m2m_wifi_get_state_ExpectAndReturn(0);
     // WINC download mode must be enabled before writing to flash
     m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    // The range is checked against the flash size before writing, 4 Mbit flash
+    spi_flash_get_size_ExpectAndReturn(4);
     // Configure spi_flash mock
     spi_flash_write_ExpectAndReturn(data, address, data_length, m2m_status);
 }
@@ -119,6 +219,7 @@ static void configure_mock_spi_flash_erase(uint16_t address, int8_t m2m_status)
     m2m_wifi_get_state_ExpectAndReturn(0);
     // WINC download mode must be enabled before writing to flash
     m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
     // Configure spi_flash mock
     spi_flash_erase_ExpectAndReturn(address, FLASH_SECTOR_SZ, m2m_status);
 }
@@ -131,6 +232,7 @@ static void configure_mock_spi_flash_read(uint8_t *data, uint16_t address, uint1
     m2m_wifi_get_state_ExpectAndReturn(0);
     // WINC download mode must be enabled before writing to flash
     m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
     // Configure spi_flash mock. Second half of data buffer is used for the raw binary data while the hex encoded data will begin at the start of the buffer
     spi_flash_read_ExpectAndReturn(data, address, data_length, m2m_status);
 }
@@ -344,6 +446,25 @@ void test_cmd_winc_read_spi_flash_read_returns_error(void)
     TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC read does not return any data when it fails so it should set data_length to 0");
 }
 
+void test_cmd_winc_read_reports_failed_pipelined_page(void)
+{
+    uint8_t argc = WINC_READ_NUM_ARGS;
+    uint16_t data_length = FLASH_PAGE_SZ;
+    uint8_t data[FLASH_PAGE_SZ*2];
+    uint32_t address = 16;
+    char *argv[WINC_READ_NUM_ARGS];
+
+    populate_read_argv(argv, address, data_length);
+
+    // The page written by the previous command fails verification when the read completes it
+    configure_mock_spi_flash_read(data+data_length, address, data_length, SPI_FLASH_ERR_VERIFY);
+
+    uint16_t result = cmd_winc_read(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_VERIFY_FAILED, result, "WINC read did not report the failed page");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC read does not return any data when it fails so it should set data_length to 0");
+}
+
 void  test_cmd_winc_read_more_than_one_page_returns_error(void)
 {
     uint8_t argc = WINC_READ_NUM_ARGS;
@@ -457,6 +578,7 @@ void test_cmd_winc_erasesector_when_winc_is_initialized_runs_deinit(void)
     m2m_wifi_deinit_ExpectAndReturn(NULL, M2M_SUCCESS);
     // WINC download mode must be enabled before writing to flash
     m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
     // Configure spi_flash mock
     spi_flash_erase_ExpectAndReturn(address, FLASH_SECTOR_SZ, M2M_SUCCESS);
 
@@ -511,4 +633,1419 @@ void test_cmd_winc_erasesector_too_few_arguments_returns_error(void)
     TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC erase sector does not return any data so it should set data_length to 0");
 }
 
+void test_cmd_winc_sectormap_one_sector_returns_ok(void)
+{
+    uint8_t argc = WINC_SECTORMAP_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint8_t erased_page[FLASH_PAGE_SZ];
+    uint16_t data_length = 0;
+    // CRC-32 of a sector with all bytes 0xFF
+    const char *expected_digest = "F154670A";
+    uint32_t address = FLASH_SECTOR_SZ;
+    char *argv[WINC_SECTORMAP_NUM_ARGS];
+
+    populate_sectormap_argv(argv, address, 1);
+    memset(erased_page, 0xFF, sizeof(erased_page));
+
+    // WINC state should be checked before setting download mode.
+    // Just assume WINC is not in use (0 means WIFI_STATE_DEINIT)
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    // The sector should be read one page at a time into the last page of the data buffer
+    for (uint32_t offset = 0; offset < FLASH_SECTOR_SZ; offset += FLASH_PAGE_SZ) {
+        spi_flash_read_ExpectAndReturn(data + MC_DATA_BUFFER_LENGTH - FLASH_PAGE_SZ, address + offset, FLASH_PAGE_SZ, M2M_SUCCESS);
+        spi_flash_read_ReturnMemThruPtr_pu8Buf(erased_page, FLASH_PAGE_SZ);
+    }
+
+    uint16_t result = cmd_winc_sectormap(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC sector map reported error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(WINC_SECTORMAP_DIGEST_SIZE*2, data_length, "Incorrect number of bytes received");
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(expected_digest, data, data_length, "Digest mismatch");
+}
+
+void test_cmd_winc_sectormap_spi_flash_read_returns_error(void)
+{
+    uint8_t argc = WINC_SECTORMAP_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Initialize to non-zero to check that it gets set to 0
+    uint16_t data_length = 1;
+    uint32_t address = 0;
+    char *argv[WINC_SECTORMAP_NUM_ARGS];
+
+    populate_sectormap_argv(argv, address, 2);
+
+    configure_mock_spi_flash_read(data + MC_DATA_BUFFER_LENGTH - FLASH_PAGE_SZ, address, FLASH_PAGE_SZ, STATUS_M2M_ERR_FAIL);
+
+    uint16_t result = cmd_winc_sectormap(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(STATUS_MC_M2M_ERR_FAIL, result, "WINC sector map did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC sector map does not return any data when it fails so it should set data_length to 0");
+}
+
+void test_cmd_winc_sectormap_unaligned_address_returns_error(void)
+{
+    uint8_t argc = WINC_SECTORMAP_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Initialize to non-zero to check that it gets set to 0
+    uint16_t data_length = 1;
+    char *argv[WINC_SECTORMAP_NUM_ARGS];
+
+    populate_sectormap_argv(argv, FLASH_PAGE_SZ, 1);
+
+    uint16_t result = cmd_winc_sectormap(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_ARGUMENT_VALUE, result, "WINC sector map did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC sector map does not return any data when it fails so it should set data_length to 0");
+}
+
+void test_cmd_winc_sectormap_too_many_sectors_returns_error(void)
+{
+    uint8_t argc = WINC_SECTORMAP_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Initialize to non-zero to check that it gets set to 0
+    uint16_t data_length = 1;
+    char *argv[WINC_SECTORMAP_NUM_ARGS];
+
+    populate_sectormap_argv(argv, 0, WINC_SECTORMAP_MAX_COUNT + 1);
+
+    uint16_t result = cmd_winc_sectormap(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_ARGUMENT_VALUE, result, "WINC sector map did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC sector map does not return any data when it fails so it should set data_length to 0");
+}
+
+void test_cmd_winc_readstream_multiple_chunks_returns_ok(void)
+{
+    uint8_t argc = WINC_READSTREAM_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint8_t erased[WINC_READSTREAM_CHUNK_SIZE];
+    uint16_t data_length = 0;
+    // Spans one full chunk and one partial chunk
+    uint32_t length = WINC_READSTREAM_CHUNK_SIZE + 188;
+    uint32_t address = FLASH_SECTOR_SZ;
+    // CRC-32 of 700 bytes of 0xFF
+    const char *expected_crc = "11E4D3CD";
+    char *argv[WINC_READSTREAM_NUM_ARGS];
+
+    populate_readstream_argv(argv, address, length);
+    memset(erased, 0xFF, sizeof(erased));
+    streamed_length = 0;
+    mc_stream_data_StubWithCallback(capture_stream);
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_get_size_ExpectAndReturn(4);
+    // Each chunk should be read into the second half of the data buffer
+    spi_flash_read_ExpectAndReturn(data + WINC_READSTREAM_CHUNK_SIZE, address, WINC_READSTREAM_CHUNK_SIZE, M2M_SUCCESS);
+    spi_flash_read_ReturnMemThruPtr_pu8Buf(erased, WINC_READSTREAM_CHUNK_SIZE);
+    spi_flash_read_ExpectAndReturn(data + WINC_READSTREAM_CHUNK_SIZE, address + WINC_READSTREAM_CHUNK_SIZE, 188, M2M_SUCCESS);
+    spi_flash_read_ReturnMemThruPtr_pu8Buf(erased, 188);
+
+    uint16_t result = cmd_winc_readstream(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC read stream reported error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(length*2 + 2, streamed_length, "Incorrect number of bytes streamed");
+    for (uint16_t i = 0; i < length*2; i++) {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE('F', streamed[i], "Streamed data mismatch");
+    }
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE("\r\n", &streamed[length*2], 2, "Stream should be terminated by a newline");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(CHECKSUM_CRC32_SIZE*2, data_length, "Incorrect number of bytes received");
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(expected_crc, data, data_length, "Checksum mismatch");
+}
+
+void test_cmd_winc_readstream_spi_flash_read_returns_error(void)
+{
+    uint8_t argc = WINC_READSTREAM_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Initialize to non-zero to check that it gets set to 0
+    uint16_t data_length = 1;
+    char *argv[WINC_READSTREAM_NUM_ARGS];
+
+    populate_readstream_argv(argv, 0, 16);
+    streamed_length = 0;
+    mc_stream_data_StubWithCallback(capture_stream);
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_get_size_ExpectAndReturn(4);
+    spi_flash_read_ExpectAndReturn(data + WINC_READSTREAM_CHUNK_SIZE, 0, 16, STATUS_M2M_ERR_FAIL);
+
+    uint16_t result = cmd_winc_readstream(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(STATUS_MC_M2M_ERR_FAIL, result, "WINC read stream did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC read stream does not return any data when it fails so it should set data_length to 0");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(2, streamed_length, "Partial stream should only be terminated by a newline");
+}
+
+void test_cmd_winc_readstream_past_end_of_flash_returns_error(void)
+{
+    uint8_t argc = WINC_READSTREAM_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Initialize to non-zero to check that it gets set to 0
+    uint16_t data_length = 1;
+    char *argv[WINC_READSTREAM_NUM_ARGS];
+
+    // Last sector of a 4 Mbit flash and one byte past it
+    populate_readstream_argv(argv, WINC_FLASH_4M_SIZE - FLASH_SECTOR_SZ, FLASH_SECTOR_SZ + 1);
+    streamed_length = 0;
+    mc_stream_data_StubWithCallback(capture_stream);
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_get_size_ExpectAndReturn(4);
+
+    uint16_t result = cmd_winc_readstream(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_ARGUMENT_VALUE, result, "WINC read stream did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC read stream does not return any data when it fails so it should set data_length to 0");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, streamed_length, "Nothing should be streamed when the range is rejected");
+}
+
+void test_cmd_winc_readstream_zero_length_returns_error(void)
+{
+    uint8_t argc = WINC_READSTREAM_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Initialize to non-zero to check that it gets set to 0
+    uint16_t data_length = 1;
+    char *argv[WINC_READSTREAM_NUM_ARGS];
+
+    populate_readstream_argv(argv, 0, 0);
+
+    uint16_t result = cmd_winc_readstream(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_ARGUMENT_VALUE, result, "WINC read stream did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC read stream does not return any data when it fails so it should set data_length to 0");
+}
+
+// Helper to set up the mocks for entering download mode and checking the source and destination against a 4 Mbit flash
+static void expect_copy_download_mode(void)
+{
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_get_size_ExpectAndReturn(4);
+    spi_flash_get_size_ExpectAndReturn(4);
+}
+
+void test_cmd_winc_copy_unaligned_destination_returns_ok(void)
+{
+    uint8_t argc = WINC_COPY_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint8_t source_data[FLASH_PAGE_SZ];
+    uint16_t data_length = 0;
+    uint32_t source = FLASH_SECTOR_SZ;
+    // Half way into a page so the first chunk only fills the rest of that page
+    uint32_t destination = 2*FLASH_SECTOR_SZ + FLASH_PAGE_SZ/2;
+    uint32_t length = FLASH_PAGE_SZ + 44;
+    char *argv[WINC_COPY_NUM_ARGS];
+
+    populate_copy_argv(argv, source, destination, length);
+    for (uint16_t i = 0; i < sizeof(source_data); i++) {
+        source_data[i] = (uint8_t) i;
+    }
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_get_size_ExpectAndReturn(4);
+    spi_flash_get_size_ExpectAndReturn(4);
+    spi_flash_read_ExpectAndReturn(data, source, FLASH_PAGE_SZ/2, M2M_SUCCESS);
+    spi_flash_read_ReturnMemThruPtr_pu8Buf(source_data, FLASH_PAGE_SZ/2);
+    spi_flash_write_ExpectAndReturn(data, destination, FLASH_PAGE_SZ/2, M2M_SUCCESS);
+    spi_flash_read_ExpectAndReturn(data, source + FLASH_PAGE_SZ/2, FLASH_PAGE_SZ/2 + 44, M2M_SUCCESS);
+    spi_flash_read_ReturnMemThruPtr_pu8Buf(source_data, FLASH_PAGE_SZ/2 + 44);
+    spi_flash_write_ExpectAndReturn(data, destination + FLASH_PAGE_SZ/2, FLASH_PAGE_SZ/2 + 44, M2M_SUCCESS);
+
+    uint16_t result = cmd_winc_copy(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC copy reported error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC copy does not return any data so it should set data_length to 0");
+}
+
+void test_cmd_winc_copy_skips_erased_pages(void)
+{
+    uint8_t argc = WINC_COPY_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint8_t erased_page[FLASH_PAGE_SZ];
+    uint16_t data_length = 0;
+    char *argv[WINC_COPY_NUM_ARGS];
+
+    populate_copy_argv(argv, 0, FLASH_SECTOR_SZ, FLASH_PAGE_SZ);
+    memset(erased_page, 0xFF, sizeof(erased_page));
+
+    expect_copy_download_mode();
+    spi_flash_read_ExpectAndReturn(data, 0, FLASH_PAGE_SZ, M2M_SUCCESS);
+    spi_flash_read_ReturnMemThruPtr_pu8Buf(erased_page, FLASH_PAGE_SZ);
+    // No spi_flash_write expected
+
+    uint16_t result = cmd_winc_copy(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC copy reported error");
+}
+
+void test_cmd_winc_copy_overlapping_ranges_returns_error(void)
+{
+    uint8_t argc = WINC_COPY_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Initialize to non-zero to check that it gets set to 0
+    uint16_t data_length = 1;
+    char *argv[WINC_COPY_NUM_ARGS];
+
+    populate_copy_argv(argv, FLASH_SECTOR_SZ, FLASH_SECTOR_SZ + FLASH_PAGE_SZ, 2*FLASH_PAGE_SZ);
+    expect_copy_download_mode();
+
+    uint16_t result = cmd_winc_copy(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_ARGUMENT_VALUE, result, "WINC copy did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC copy does not return any data so it should set data_length to 0");
+}
+
+void test_cmd_winc_copy_destination_past_end_of_flash_returns_error(void)
+{
+    uint8_t argc = WINC_COPY_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+    char *argv[WINC_COPY_NUM_ARGS];
+
+    // The last page of a 4 Mbit flash copied one page further
+    populate_copy_argv(argv, WINC_FLASH_4M_SIZE - 2*FLASH_PAGE_SZ, WINC_FLASH_4M_SIZE - FLASH_PAGE_SZ + 1, FLASH_PAGE_SZ);
+    expect_copy_download_mode();
+
+    uint16_t result = cmd_winc_copy(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_ARGUMENT_VALUE, result, "WINC copy did not report expected error");
+}
+
+void test_cmd_winc_copy_wrapping_range_returns_error(void)
+{
+    uint8_t argc = WINC_COPY_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+    char *argv[WINC_COPY_NUM_ARGS];
+
+    // source + length wraps to 0 so a wrapping overlap test would let this pass
+    populate_copy_argv(argv, 0x100, FLASH_SECTOR_SZ, 0xFFFFFF00);
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_get_size_ExpectAndReturn(4);
+
+    uint16_t result = cmd_winc_copy(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_ARGUMENT_VALUE, result, "WINC copy did not report expected error");
+}
+
+void test_cmd_winc_copy_spi_flash_read_returns_error(void)
+{
+    uint8_t argc = WINC_COPY_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+    char *argv[WINC_COPY_NUM_ARGS];
+
+    populate_copy_argv(argv, 0, FLASH_SECTOR_SZ, 2*FLASH_PAGE_SZ);
+
+    expect_copy_download_mode();
+    spi_flash_read_ExpectAndReturn(data, 0, FLASH_PAGE_SZ, STATUS_M2M_ERR_FAIL);
+
+    uint16_t result = cmd_winc_copy(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(STATUS_MC_M2M_ERR_FAIL, result, "WINC copy did not report expected error");
+}
+
+void test_cmd_winc_fill_returns_ok(void)
+{
+    uint8_t argc = WINC_FILL_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint8_t expected[FLASH_PAGE_SZ];
+    uint16_t data_length = 0;
+    uint32_t address = FLASH_SECTOR_SZ + 16;
+    char *argv[WINC_FILL_NUM_ARGS];
+
+    populate_fill_argv(argv, address, FLASH_PAGE_SZ, 0xA5);
+    memset(expected, 0xA5, sizeof(expected));
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_get_size_ExpectAndReturn(4);
+    spi_flash_write_ExpectAndReturn(data, address, FLASH_PAGE_SZ - 16, M2M_SUCCESS);
+    spi_flash_write_ExpectAndReturn(data, address + FLASH_PAGE_SZ - 16, 16, M2M_SUCCESS);
+
+    uint16_t result = cmd_winc_fill(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC fill reported error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC fill does not return any data so it should set data_length to 0");
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(expected, data, FLASH_PAGE_SZ, "Fill pattern mismatch");
+}
+
+void test_cmd_winc_fill_erased_value_does_not_write(void)
+{
+    uint8_t argc = WINC_FILL_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+    char *argv[WINC_FILL_NUM_ARGS];
+
+    populate_fill_argv(argv, 0, FLASH_SECTOR_SZ, 0xFF);
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_get_size_ExpectAndReturn(4);
+    // No spi_flash_write expected
+
+    uint16_t result = cmd_winc_fill(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC fill reported error");
+}
+
+void test_cmd_winc_fill_past_end_of_flash_returns_error(void)
+{
+    uint8_t argc = WINC_FILL_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+    char *argv[WINC_FILL_NUM_ARGS];
+
+    // address + length wraps to the start of the flash
+    populate_fill_argv(argv, WINC_FLASH_4M_SIZE - FLASH_PAGE_SZ, 0xFFFFFFFF, 0xA5);
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_get_size_ExpectAndReturn(4);
+    // No spi_flash_write expected
+
+    uint16_t result = cmd_winc_fill(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_ARGUMENT_VALUE, result, "WINC fill did not report expected error");
+}
+
+void test_cmd_winc_fill_value_too_large_returns_error(void)
+{
+    uint8_t argc = WINC_FILL_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Initialize to non-zero to check that it gets set to 0
+    uint16_t data_length = 1;
+    char *argv[WINC_FILL_NUM_ARGS];
+
+    populate_fill_argv(argv, 0, FLASH_PAGE_SZ, 0x100);
+
+    uint16_t result = cmd_winc_fill(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_ARGUMENT_VALUE, result, "WINC fill did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC fill does not return any data so it should set data_length to 0");
+}
+
+void test_cmd_winc_rootcert_add_to_empty_sector_writes_new_store(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length;
+    uint8_t entry[ROOTCERT_ECDSA_ENTRY_SIZE];
+    uint8_t erased[WINC_ROOTCERT_HEADER_SIZE];
+    uint8_t expected_header[WINC_ROOTCERT_HEADER_SIZE] = WINC_ROOTCERT_START_PATTERN;
+    uint8_t *page = data + MC_DATA_BUFFER_LENGTH - FLASH_PAGE_SZ;
+    char *argv[WINC_ROOTCERT_NUM_ARGS];
+
+    generate_rootcert_entry(entry, 0xA5);
+    data_length = convert_bin2hex(sizeof(entry), entry, data);
+    populate_rootcert_argv(argv, sizeof(entry));
+    memset(erased, 0xFF, sizeof(erased));
+    memset(expected_header + WINC_ROOTCERT_START_PATTERN_SIZE, 0, 4);
+    expected_header[WINC_ROOTCERT_START_PATTERN_SIZE] = 1;
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_snapshot_ExpectAndReturn(M2M_TLS_ROOTCER_FLASH_OFFSET, M2M_TLS_ROOTCER_FLASH_SIZE, M2M_SUCCESS);
+    spi_flash_snapshot_read_ExpectAndReturn(NULL, 0, WINC_ROOTCERT_HEADER_SIZE, M2M_SUCCESS);
+    spi_flash_snapshot_read_IgnoreArg_pu8Buf();
+    spi_flash_snapshot_read_ReturnArrayThruPtr_pu8Buf(erased, sizeof(erased));
+    spi_flash_erase_ExpectAndReturn(M2M_TLS_ROOTCER_FLASH_OFFSET, M2M_TLS_ROOTCER_FLASH_SIZE, M2M_SUCCESS);
+    spi_flash_write_ExpectAndReturn(page, M2M_TLS_ROOTCER_FLASH_OFFSET, WINC_ROOTCERT_HEADER_SIZE + sizeof(entry), M2M_SUCCESS);
+
+    uint16_t result = cmd_winc_rootcert_add(WINC_ROOTCERT_NUM_ARGS, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC rootcert add reported error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC rootcert add does not return any data so it should set data_length to 0");
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(expected_header, page, WINC_ROOTCERT_HEADER_SIZE, "Store header mismatch");
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(entry, page + WINC_ROOTCERT_HEADER_SIZE, sizeof(entry), "Store entry mismatch");
+}
+
+void test_cmd_winc_rootcert_add_replaces_entry_with_same_name(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length;
+    uint8_t entry[ROOTCERT_ECDSA_ENTRY_SIZE];
+    uint8_t store_header[WINC_ROOTCERT_HEADER_SIZE] = WINC_ROOTCERT_START_PATTERN;
+    uint8_t *page = data + MC_DATA_BUFFER_LENGTH - FLASH_PAGE_SZ;
+    char *argv[WINC_ROOTCERT_NUM_ARGS];
+
+    memset(store_header + WINC_ROOTCERT_START_PATTERN_SIZE, 0, 4);
+    store_header[WINC_ROOTCERT_START_PATTERN_SIZE] = 1;
+    // The stored entry has the same name as the new one
+    generate_rootcert_entry(entry, 0xA5);
+    data_length = convert_bin2hex(sizeof(entry), entry, data);
+    populate_rootcert_argv(argv, sizeof(entry));
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_snapshot_ExpectAndReturn(M2M_TLS_ROOTCER_FLASH_OFFSET, M2M_TLS_ROOTCER_FLASH_SIZE, M2M_SUCCESS);
+    spi_flash_snapshot_read_ExpectAndReturn(NULL, 0, WINC_ROOTCERT_HEADER_SIZE, M2M_SUCCESS);
+    spi_flash_snapshot_read_IgnoreArg_pu8Buf();
+    spi_flash_snapshot_read_ReturnArrayThruPtr_pu8Buf(store_header, sizeof(store_header));
+    spi_flash_snapshot_read_ExpectAndReturn(NULL, WINC_ROOTCERT_HEADER_SIZE, WINC_ROOTCERT_ENTRY_HEADER_SIZE, M2M_SUCCESS);
+    spi_flash_snapshot_read_IgnoreArg_pu8Buf();
+    spi_flash_snapshot_read_ReturnArrayThruPtr_pu8Buf(entry, WINC_ROOTCERT_ENTRY_HEADER_SIZE);
+    // Nothing else is kept from the old store, so the entry count stays the same
+    spi_flash_erase_ExpectAndReturn(M2M_TLS_ROOTCER_FLASH_OFFSET, M2M_TLS_ROOTCER_FLASH_SIZE, M2M_SUCCESS);
+    spi_flash_write_ExpectAndReturn(page, M2M_TLS_ROOTCER_FLASH_OFFSET, WINC_ROOTCERT_HEADER_SIZE + sizeof(entry), M2M_SUCCESS);
+
+    uint16_t result = cmd_winc_rootcert_add(WINC_ROOTCERT_NUM_ARGS, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC rootcert add reported error");
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(store_header, page, WINC_ROOTCERT_HEADER_SIZE, "Store header mismatch");
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(entry, page + WINC_ROOTCERT_HEADER_SIZE, sizeof(entry), "Store entry mismatch");
+}
+
+void test_cmd_winc_rootcert_add_size_mismatch_returns_error(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length;
+    uint8_t entry[ROOTCERT_ECDSA_ENTRY_SIZE];
+    char *argv[WINC_ROOTCERT_NUM_ARGS];
+
+    // The key in the header is larger than the entry sent
+    generate_rootcert_entry(entry, 0xA5);
+    data_length = convert_bin2hex(sizeof(entry) - 4, entry, data);
+    populate_rootcert_argv(argv, sizeof(entry) - 4);
+
+    uint16_t result = cmd_winc_rootcert_add(WINC_ROOTCERT_NUM_ARGS, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_BLOB, result, "WINC rootcert add did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC rootcert add does not return any data so it should set data_length to 0");
+}
+
+void test_cmd_winc_rootcert_clear_writes_empty_store(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+    uint8_t expected_header[WINC_ROOTCERT_HEADER_SIZE] = WINC_ROOTCERT_START_PATTERN;
+    uint8_t *page = data + MC_DATA_BUFFER_LENGTH - FLASH_PAGE_SZ;
+
+    memset(expected_header + WINC_ROOTCERT_START_PATTERN_SIZE, 0, 4);
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_erase_ExpectAndReturn(M2M_TLS_ROOTCER_FLASH_OFFSET, M2M_TLS_ROOTCER_FLASH_SIZE, M2M_SUCCESS);
+    spi_flash_write_ExpectAndReturn(page, M2M_TLS_ROOTCER_FLASH_OFFSET, WINC_ROOTCERT_HEADER_SIZE, M2M_SUCCESS);
+
+    uint16_t result = cmd_winc_rootcert_clear(0, NULL, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC rootcert clear reported error");
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(expected_header, page, WINC_ROOTCERT_HEADER_SIZE, "Store header mismatch");
+}
+
+void test_cmd_winc_writecompressed_run_and_literal_returns_ok(void)
+{
+    uint8_t argc = WINC_WRITE_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint8_t expected[FLASH_PAGE_SZ];
+    // A run of 252 0x55 followed by a literal of 4 bytes, decompressing to exactly one page
+    const char *stream = "FF55FB550301020304";
+    uint16_t data_length = strlen(stream);
+    uint32_t address = FLASH_SECTOR_SZ;
+    char *argv[WINC_WRITE_NUM_ARGS];
+
+    populate_write_argv(argv, address, FLASH_PAGE_SZ);
+    memcpy(data, stream, data_length);
+    memset(expected, 0x55, FLASH_PAGE_SZ);
+    expected[FLASH_PAGE_SZ-4] = 0x01;
+    expected[FLASH_PAGE_SZ-3] = 0x02;
+    expected[FLASH_PAGE_SZ-2] = 0x03;
+    expected[FLASH_PAGE_SZ-1] = 0x04;
+
+    // The page is decompressed into the last page of the data buffer
+    configure_mock_spi_flash_write(data + MC_DATA_BUFFER_LENGTH - FLASH_PAGE_SZ, address, FLASH_PAGE_SZ, M2M_SUCCESS);
+
+    uint16_t result = cmd_winc_writecompressed(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC writecompressed reported error");
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(expected, data + MC_DATA_BUFFER_LENGTH - FLASH_PAGE_SZ, FLASH_PAGE_SZ, "Data mismatch");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC writecompressed does not return any data so it should set data_length to 0");
+}
+
+void test_cmd_winc_writecompressed_erased_pages_are_skipped(void)
+{
+    uint8_t argc = WINC_WRITE_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Two pages of 0xFF
+    const char *stream = "FFFFFFFFFFFFFFFF";
+    uint16_t data_length = strlen(stream);
+    uint32_t address = 0;
+    char *argv[WINC_WRITE_NUM_ARGS];
+
+    populate_write_argv(argv, address, FLASH_PAGE_SZ*2);
+    memcpy(data, stream, data_length);
+
+    // Download mode is entered, but there should not be any flash writes
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_get_size_ExpectAndReturn(4);
+
+    uint16_t result = cmd_winc_writecompressed(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC writecompressed reported error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC writecompressed does not return any data so it should set data_length to 0");
+}
+
+void test_cmd_winc_writecompressed_length_mismatch_returns_error(void)
+{
+    uint8_t argc = WINC_WRITE_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Decompresses to 128 bytes
+    const char *stream = "FF00";
+    uint16_t data_length = strlen(stream);
+    char *argv[WINC_WRITE_NUM_ARGS];
+
+    populate_write_argv(argv, 0, 129);
+    memcpy(data, stream, data_length);
+
+    uint16_t result = cmd_winc_writecompressed(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_BLOB, result, "WINC writecompressed did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC writecompressed does not return any data so it should set data_length to 0");
+}
+
+void test_cmd_winc_writecompressed_truncated_stream_returns_error(void)
+{
+    uint8_t argc = WINC_WRITE_NUM_ARGS;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Literal token announcing 4 bytes, but only 2 bytes follow
+    const char *stream = "030102";
+    uint16_t data_length = strlen(stream);
+    char *argv[WINC_WRITE_NUM_ARGS];
+
+    populate_write_argv(argv, 0, 4);
+    memcpy(data, stream, data_length);
+
+    uint16_t result = cmd_winc_writecompressed(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_BLOB, result, "WINC writecompressed did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC writecompressed does not return any data so it should set data_length to 0");
+}
+
+void test_cmd_winc_timing_returns_ok(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+    tstrSpiFlashTiming page_program = {.u32Count = 4, .u32MinUs = 600, .u32MaxUs = 900, .u32TotalUs = 2800};
+    tstrSpiFlashTiming sector_erase = {0};
+    // The mode switch line depends on the previous tests so only the flash operations are checked
+    const char *expected = "PAGEPROGRAM,4,600,700,900\r\nSECTORERASE,0,0,0,0\r\nMODESWITCH,";
+
+    spi_flash_get_timing_Expect(SPI_FLASH_OP_PAGE_PROGRAM, NULL);
+    spi_flash_get_timing_IgnoreArg_pstrTiming();
+    spi_flash_get_timing_ReturnThruPtr_pstrTiming(&page_program);
+    spi_flash_get_timing_Expect(SPI_FLASH_OP_SECTOR_ERASE, NULL);
+    spi_flash_get_timing_IgnoreArg_pstrTiming();
+    spi_flash_get_timing_ReturnThruPtr_pstrTiming(&sector_erase);
+
+    uint16_t result = cmd_winc_timing(0, NULL, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC timing reported error");
+    TEST_ASSERT_GREATER_THAN_UINT16_MESSAGE(strlen(expected), data_length, "Incorrect number of bytes received");
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(expected, data, strlen(expected), "Report mismatch");
+}
+
+void test_cmd_winc_timing_reset_clears_measurements(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+    char *argv[WINC_TIMING_NUM_ARGS] = {"RESET"};
+
+    mc_match_string_ExpectAndReturn(WINC_TIMING_RESET, argv[WINC_TIMING_ARG_RESET], 1);
+    spi_flash_get_timing_ExpectAnyArgs();
+    spi_flash_get_timing_ExpectAnyArgs();
+    // Measurements should be cleared after they have been reported
+    spi_flash_reset_timing_Expect();
+
+    uint16_t result = cmd_winc_timing(WINC_TIMING_NUM_ARGS, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC timing reported error");
+}
+
+void test_cmd_winc_timing_unknown_argument_returns_error(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Just set length to anything but 0 to check that it gets set to 0 by the timing command implementation
+    uint16_t data_length = 1;
+    char *argv[WINC_TIMING_NUM_ARGS] = {"CLEAR"};
+
+    mc_match_string_ExpectAndReturn(WINC_TIMING_RESET, argv[WINC_TIMING_ARG_RESET], 0);
+
+    uint16_t result = cmd_winc_timing(WINC_TIMING_NUM_ARGS, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_ARGUMENT_VALUE, result, "WINC timing did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC timing should not return any data on error");
+}
+
+void test_cmd_winc_writeblob_end_of_sector_records_progress(void)
+{
+    uint8_t argc = WINC_WRITE_NUM_ARGS;
+    uint16_t data_length = 16;
+    uint8_t data_hex[32];
+    uint16_t data_length_hex = sizeof(data_hex);
+    // Last bytes of the second sector
+    uint32_t address = 2*FLASH_SECTOR_SZ - data_length;
+    char *argv[WINC_WRITE_NUM_ARGS];
+
+    populate_write_argv(argv, address, data_length);
+    memset(data_hex, '0', sizeof(data_hex));
+
+    configure_mock_spi_flash_write(data_hex, address, data_length, M2M_SUCCESS);
+    winc_journal_active_StopIgnore();
+    winc_journal_active_ExpectAndReturn(true);
+    // The flush is ignored, but the sector must only be recorded after it
+    winc_journal_add_sector_ExpectAndReturn(1, true);
+
+    uint16_t result = cmd_winc_writeblob(argc, argv, data_hex, &data_length_hex);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC writeblob reported error");
+}
+
+void test_cmd_winc_resume_reports_session(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+    uint32_t session_id = 42;
+    uint8_t digest[WINC_JOURNAL_DIGEST_SIZE];
+    winc_journal_range_t range = {.first_sector = 2, .sector_count = 3};
+    const char *expected = "SESSION,42\r\n"
+                           "DIGEST,0000000000000000000000000000000000000000000000000000000000000000\r\n"
+                           "RANGE,8192,12288\r\n";
+
+    memset(digest, 0, sizeof(digest));
+
+    winc_journal_get_session_ExpectAnyArgsAndReturn(true);
+    winc_journal_get_session_ReturnThruPtr_session_id(&session_id);
+    winc_journal_get_session_ReturnMemThruPtr_digest(digest, sizeof(digest));
+    winc_journal_get_range_ExpectAndReturn(0, NULL, true);
+    winc_journal_get_range_IgnoreArg_range();
+    winc_journal_get_range_ReturnThruPtr_range(&range);
+    winc_journal_get_range_ExpectAndReturn(1, NULL, false);
+    winc_journal_get_range_IgnoreArg_range();
+
+    uint16_t result = cmd_winc_resume(0, NULL, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC resume reported error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(strlen(expected), data_length, "Incorrect number of bytes received");
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(expected, data, data_length, "Report mismatch");
+}
+
+void test_cmd_winc_resume_without_session_returns_no_data(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Just set length to anything but 0 to check that it gets set to 0 by the resume command implementation
+    uint16_t data_length = 1;
+
+    winc_journal_get_session_ExpectAnyArgsAndReturn(false);
+
+    uint16_t result = cmd_winc_resume(0, NULL, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC resume reported error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC resume should not return any data without a session");
+}
+
+void test_cmd_winc_resume_start_begins_session(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+    uint8_t expected_digest[WINC_JOURNAL_DIGEST_SIZE];
+    char digest_hex[WINC_JOURNAL_DIGEST_SIZE*2 + 1];
+    char *argv[WINC_RESUME_NUM_ARGS] = {"START", "7", digest_hex};
+
+    for (uint8_t i = 0; i < WINC_JOURNAL_DIGEST_SIZE; i++) {
+        expected_digest[i] = i;
+        snprintf(&digest_hex[i*2], 3, "%02X", i);
+    }
+
+    mc_match_string_ExpectAndReturn(WINC_RESUME_START, argv[WINC_RESUME_ARG_ACTION], 1);
+    // The digest is decoded into the end of the data buffer
+    winc_journal_start_Expect(7, data + MC_DATA_BUFFER_LENGTH - WINC_JOURNAL_DIGEST_SIZE);
+
+    uint16_t result = cmd_winc_resume(WINC_RESUME_NUM_ARGS, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC resume reported error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC resume start does not return any data");
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(expected_digest, data + MC_DATA_BUFFER_LENGTH - WINC_JOURNAL_DIGEST_SIZE, WINC_JOURNAL_DIGEST_SIZE, "Digest mismatch");
+}
+
+void test_cmd_winc_resume_start_with_short_digest_returns_error(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+    char *argv[WINC_RESUME_NUM_ARGS] = {"START", "7", "0011"};
+
+    mc_match_string_ExpectAndReturn(WINC_RESUME_START, argv[WINC_RESUME_ARG_ACTION], 1);
+
+    uint16_t result = cmd_winc_resume(WINC_RESUME_NUM_ARGS, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_ARGUMENT_VALUE, result, "WINC resume did not report expected error");
+}
+
+void test_cmd_winc_resume_argv_null_returns_error(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_ARGUMENT_VALUE, cmd_winc_resume(1, NULL, data, &data_length), "WINC resume did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_ARGUMENT_VALUE, cmd_winc_resume(WINC_RESUME_NUM_ARGS, NULL, data, &data_length), "WINC resume did not report expected error");
+}
+
+// Helper that starts an auto-erase session on a 4 Mbit flash
+static void start_autoerase_session(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+    char *argv[WINC_AUTOERASE_NUM_ARGS] = {"ON"};
+
+    mc_match_string_ExpectAndReturn(WINC_AUTOERASE_OFF, argv[WINC_AUTOERASE_ARG_MODE], 0);
+    mc_match_string_ExpectAndReturn(WINC_AUTOERASE_ON, argv[WINC_AUTOERASE_ARG_MODE], 1);
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_get_size_ExpectAndReturn(4);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, cmd_winc_autoerase(WINC_AUTOERASE_NUM_ARGS, argv, data, &data_length), "WINC autoerase reported error");
+}
+
+// Helper that ends an auto-erase session so it doesn't affect other tests
+static void stop_autoerase_session(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+    char *argv[WINC_AUTOERASE_NUM_ARGS] = {"OFF"};
+
+    mc_match_string_ExpectAndReturn(WINC_AUTOERASE_OFF, argv[WINC_AUTOERASE_ARG_MODE], 1);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, cmd_winc_autoerase(WINC_AUTOERASE_NUM_ARGS, argv, data, &data_length), "WINC autoerase reported error");
+}
+
+void test_cmd_winc_autoerase_erases_sector_on_first_write_only(void)
+{
+    uint8_t argc = WINC_WRITE_NUM_ARGS;
+    uint16_t data_length = FLASH_PAGE_SZ;
+    uint8_t data_hex[FLASH_PAGE_SZ*2];
+    uint16_t data_length_hex;
+    uint32_t address = FLASH_SECTOR_SZ;
+    char *argv[WINC_WRITE_NUM_ARGS];
+
+    start_autoerase_session();
+
+    // First page of the sector, the sector should be erased first
+    populate_write_argv(argv, address, data_length);
+    memset(data_hex, '0', sizeof(data_hex));
+    data_length_hex = sizeof(data_hex);
+    spi_flash_get_size_ExpectAndReturn(4);
+    spi_flash_erase_ExpectAndReturn(address, FLASH_SECTOR_SZ, M2M_SUCCESS);
+    spi_flash_write_ExpectAndReturn(data_hex, address, data_length, M2M_SUCCESS);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, cmd_winc_writeblob(argc, argv, data_hex, &data_length_hex), "WINC writeblob reported error");
+
+    // Second page of the same sector, no erase
+    populate_write_argv(argv, address + FLASH_PAGE_SZ, data_length);
+    memset(data_hex, '0', sizeof(data_hex));
+    data_length_hex = sizeof(data_hex);
+    spi_flash_get_size_ExpectAndReturn(4);
+    spi_flash_write_ExpectAndReturn(data_hex, address + FLASH_PAGE_SZ, data_length, M2M_SUCCESS);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, cmd_winc_writeblob(argc, argv, data_hex, &data_length_hex), "WINC writeblob reported error");
+
+    stop_autoerase_session();
+}
+
+void test_cmd_winc_autoerase_erases_sector_skipped_by_fill(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+    char *argv[WINC_FILL_NUM_ARGS];
+
+    start_autoerase_session();
+
+    // Nothing is programmed when filling with 0xFF, but the sector must still be erased
+    populate_fill_argv(argv, 0, FLASH_PAGE_SZ, 0xFF);
+    spi_flash_get_size_ExpectAndReturn(4);
+    spi_flash_erase_ExpectAndReturn(0, FLASH_SECTOR_SZ, M2M_SUCCESS);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, cmd_winc_fill(WINC_FILL_NUM_ARGS, argv, data, &data_length), "WINC fill reported error");
+
+    stop_autoerase_session();
+}
+
+void test_cmd_winc_autoerase_ahead_starts_erase_of_next_sector(void)
+{
+    uint8_t argc = WINC_WRITE_NUM_ARGS;
+    uint16_t data_length = FLASH_PAGE_SZ;
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint8_t data_hex[FLASH_PAGE_SZ*2];
+    uint16_t data_length_hex;
+    uint32_t address = 2*FLASH_SECTOR_SZ - FLASH_PAGE_SZ;
+    char *argv[WINC_WRITE_NUM_ARGS];
+    char *mode_argv[WINC_AUTOERASE_NUM_ARGS] = {"AHEAD"};
+    uint16_t mode_length = 0;
+
+    mc_match_string_ExpectAndReturn(WINC_AUTOERASE_OFF, mode_argv[WINC_AUTOERASE_ARG_MODE], 0);
+    mc_match_string_ExpectAndReturn(WINC_AUTOERASE_ON, mode_argv[WINC_AUTOERASE_ARG_MODE], 0);
+    mc_match_string_ExpectAndReturn(WINC_AUTOERASE_AHEAD, mode_argv[WINC_AUTOERASE_ARG_MODE], 1);
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_get_size_ExpectAndReturn(4);
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, cmd_winc_autoerase(WINC_AUTOERASE_NUM_ARGS, mode_argv, data, &mode_length), "WINC autoerase reported error");
+
+    // Last page of sector 1, sector 1 is erased before the write and sector 2 is erased in the background after it
+    populate_write_argv(argv, address, data_length);
+    memset(data_hex, '0', sizeof(data_hex));
+    data_length_hex = sizeof(data_hex);
+    spi_flash_get_size_ExpectAndReturn(4);
+    spi_flash_erase_ExpectAndReturn(FLASH_SECTOR_SZ, FLASH_SECTOR_SZ, M2M_SUCCESS);
+    spi_flash_write_ExpectAndReturn(data_hex, address, data_length, M2M_SUCCESS);
+    spi_flash_erase_start_ExpectAndReturn(2*FLASH_SECTOR_SZ, M2M_SUCCESS);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, cmd_winc_writeblob(argc, argv, data_hex, &data_length_hex), "WINC writeblob reported error");
+
+    // First page of sector 2, already being erased
+    populate_write_argv(argv, 2*FLASH_SECTOR_SZ, data_length);
+    memset(data_hex, '0', sizeof(data_hex));
+    data_length_hex = sizeof(data_hex);
+    spi_flash_get_size_ExpectAndReturn(4);
+    spi_flash_write_ExpectAndReturn(data_hex, 2*FLASH_SECTOR_SZ, data_length, M2M_SUCCESS);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, cmd_winc_writeblob(argc, argv, data_hex, &data_length_hex), "WINC writeblob reported error");
+
+    stop_autoerase_session();
+}
+
+void test_cmd_winc_autoerase_address_past_end_of_flash_does_not_erase(void)
+{
+    uint8_t argc = WINC_WRITE_NUM_ARGS;
+    uint16_t data_length = FLASH_PAGE_SZ;
+    uint8_t data_hex[FLASH_PAGE_SZ*2];
+    uint16_t data_length_hex = sizeof(data_hex);
+    // Sector index 0x10000 would wrap to sector 0 if it was truncated to 16 bits
+    uint32_t address = 0x10000000;
+    char *argv[WINC_WRITE_NUM_ARGS];
+
+    start_autoerase_session();
+
+    populate_write_argv(argv, address, data_length);
+    memset(data_hex, '0', sizeof(data_hex));
+    // Any erase or write would be reported as an unexpected call
+    spi_flash_get_size_ExpectAndReturn(4);
+
+    uint16_t result = cmd_winc_writeblob(argc, argv, data_hex, &data_length_hex);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_ARGUMENT_VALUE, result, "WINC writeblob did not report expected error");
+
+    stop_autoerase_session();
+}
+
+void test_cmd_winc_autoerase_unknown_mode_returns_error(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Just set length to anything but 0 to check that it gets set to 0 by the autoerase command implementation
+    uint16_t data_length = 1;
+    char *argv[WINC_AUTOERASE_NUM_ARGS] = {"MAYBE"};
+
+    mc_match_string_ExpectAndReturn(WINC_AUTOERASE_OFF, argv[WINC_AUTOERASE_ARG_MODE], 0);
+    mc_match_string_ExpectAndReturn(WINC_AUTOERASE_ON, argv[WINC_AUTOERASE_ARG_MODE], 0);
+    mc_match_string_ExpectAndReturn(WINC_AUTOERASE_AHEAD, argv[WINC_AUTOERASE_ARG_MODE], 0);
+
+    uint16_t result = cmd_winc_autoerase(WINC_AUTOERASE_NUM_ARGS, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_ARGUMENT_VALUE, result, "WINC autoerase did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC autoerase does not return any data so it should set data_length to 0");
+}
+
+// Helper that enables or disables read back verification
+static void set_verify_mode(bool enable)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+    char *argv[WINC_VERIFY_NUM_ARGS] = {enable ? "ON" : "OFF"};
+
+    mc_match_string_ExpectAndReturn(WINC_VERIFY_ON, argv[WINC_VERIFY_ARG_MODE], enable);
+    if (!enable) {
+        mc_match_string_ExpectAndReturn(WINC_VERIFY_OFF, argv[WINC_VERIFY_ARG_MODE], 1);
+    }
+    spi_flash_set_verify_Expect(enable);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, cmd_winc_verify(WINC_VERIFY_NUM_ARGS, argv, data, &data_length), "WINC verify reported error");
+}
+
+void test_cmd_winc_verify_mismatch_fails_writeblob(void)
+{
+    uint8_t argc = WINC_WRITE_NUM_ARGS;
+    uint16_t data_length = FLASH_PAGE_SZ;
+    uint8_t data_hex[FLASH_PAGE_SZ*2];
+    uint16_t data_length_hex = data_length*2;
+    uint32_t address = 0;
+    char *argv[WINC_WRITE_NUM_ARGS];
+
+    set_verify_mode(true);
+
+    populate_write_argv(argv, address, data_length);
+    configure_mock_spi_flash_write(data_hex, address, data_length, M2M_SUCCESS);
+    // The last page is completed and checked before the command returns
+    spi_flash_flush_StopIgnore();
+    spi_flash_flush_ExpectAndReturn(SPI_FLASH_ERR_VERIFY);
+
+    uint16_t result = cmd_winc_writeblob(argc, argv, data_hex, &data_length_hex);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_VERIFY_FAILED, result, "WINC writeblob did not report verify failure");
+
+    set_verify_mode(false);
+}
+
+void test_cmd_winc_verify_off_does_not_flush_after_write(void)
+{
+    uint8_t argc = WINC_WRITE_NUM_ARGS;
+    uint16_t data_length = FLASH_PAGE_SZ;
+    uint8_t data_hex[FLASH_PAGE_SZ*2];
+    uint16_t data_length_hex = data_length*2;
+    uint32_t address = 0;
+    char *argv[WINC_WRITE_NUM_ARGS];
+
+    populate_write_argv(argv, address, data_length);
+    configure_mock_spi_flash_write(data_hex, address, data_length, M2M_SUCCESS);
+    // Any flush would be reported as an unexpected call
+    spi_flash_flush_StopIgnore();
+
+    uint16_t result = cmd_winc_writeblob(argc, argv, data_hex, &data_length_hex);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC writeblob reported error");
+}
+
+void test_cmd_winc_verify_unknown_mode_returns_error(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Just set length to anything but 0 to check that it gets set to 0 by the verify command implementation
+    uint16_t data_length = 1;
+    char *argv[WINC_VERIFY_NUM_ARGS] = {"MAYBE"};
+
+    mc_match_string_ExpectAndReturn(WINC_VERIFY_ON, argv[WINC_VERIFY_ARG_MODE], 0);
+    mc_match_string_ExpectAndReturn(WINC_VERIFY_OFF, argv[WINC_VERIFY_ARG_MODE], 0);
+
+    uint16_t result = cmd_winc_verify(WINC_VERIFY_NUM_ARGS, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_ARGUMENT_VALUE, result, "WINC verify did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC verify does not return any data so it should set data_length to 0");
+}
+
+void test_winc_download_mode_waits_for_flash_ready(void)
+{
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    // The flash should be polled until it is ready instead of waiting a fixed time
+    spi_flash_check_ready_ExpectAndReturn(M2M_NOT_YET);
+    spi_flash_check_ready_ExpectAndReturn(M2M_NOT_YET);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+
+    uint16_t result = winc_download_mode(true);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC download mode reported error");
+}
+
+void test_winc_download_mode_flash_not_ready_returns_timeout(void)
+{
+    // STATUS_SOURCE_WINC = 2, M2M_ERR_TIME_OUT = -4 = 0xFC
+    const uint16_t expected_status = 0x02FC;
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_IgnoreAndReturn(M2M_NOT_YET);
+
+    uint16_t result = winc_download_mode(true);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(expected_status, result, "WINC download mode did not report expected error");
+}
+
+void test_winc_download_mode_recovers_bus_error(void)
+{
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    winc_download_mode(true);
+
+    // Download mode is kept when the bus can be resynced
+    winc_bus_error_StopIgnore();
+    winc_bus_error_ExpectAndReturn(true);
+    winc_bus_recover_ExpectAndReturn(WINC_BUS_SUCCESS);
+
+    uint16_t result = winc_download_mode(true);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(STATUS_SOURCE_WINC(M2M_SUCCESS), result, "WINC download mode reported error");
+}
+
+void test_winc_download_mode_restarts_when_bus_recovery_fails(void)
+{
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    winc_download_mode(true);
+
+    winc_bus_error_StopIgnore();
+    winc_bus_error_ExpectAndReturn(true);
+    winc_bus_recover_ExpectAndReturn(WINC_BUS_FAIL);
+    spi_flash_reset_pipeline_ExpectAndReturn(false);
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+
+    uint16_t result = winc_download_mode(true);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(STATUS_SOURCE_WINC(M2M_SUCCESS), result, "WINC download mode reported error");
+}
+
+void test_winc_download_mode_restart_reports_lost_flash_work(void)
+{
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    winc_download_mode(true);
+
+    // A page program was still pending when the WINC stopped responding
+    winc_bus_error_StopIgnore();
+    winc_bus_error_ExpectAndReturn(true);
+    winc_bus_recover_ExpectAndReturn(WINC_BUS_FAIL);
+    spi_flash_reset_pipeline_ExpectAndReturn(true);
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+
+    uint16_t result = winc_download_mode(true);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(STATUS_SOURCE_WINC(SPI_FLASH_ERR_LOST), result, "WINC download mode did not report lost flash work");
+
+    // Download mode was restarted, the next command goes ahead
+    winc_bus_error_ExpectAndReturn(false);
+
+    result = winc_download_mode(true);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC download mode reported error");
+}
+
+void test_cmd_winc_writeblob_fails_when_flash_work_was_lost(void)
+{
+    uint8_t argc = WINC_WRITE_NUM_ARGS;
+    uint8_t data[FLASH_PAGE_SZ*2];
+    uint16_t data_length = sizeof(data);
+    char *argv[WINC_WRITE_NUM_ARGS];
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    winc_download_mode(true);
+
+    populate_write_argv(argv, 0, FLASH_PAGE_SZ);
+    memset(data, '0', sizeof(data));
+
+    // Download mode is restarted with a page program pending, nothing must be written after that
+    winc_bus_error_StopIgnore();
+    winc_bus_error_ExpectAndReturn(true);
+    winc_bus_recover_ExpectAndReturn(WINC_BUS_FAIL);
+    spi_flash_reset_pipeline_ExpectAndReturn(true);
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+
+    uint16_t result = cmd_winc_writeblob(argc, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(STATUS_SOURCE_WINC(SPI_FLASH_ERR_LOST), result, "WINC writeblob did not report lost flash work");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC writeblob does not return any data so it should set data_length to 0");
+}
+
+void test_read_winc_version_failed_last_page_skips_firmware_info(void)
+{
+    tstrM2mRev version_info;
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    winc_download_mode(true);
+
+    // The WINC stays in download mode so its firmware must not be queried
+    spi_flash_flush_StopIgnore();
+    spi_flash_flush_ExpectAndReturn(M2M_ERR_TIME_OUT);
+
+    uint16_t result = read_winc_version(&version_info);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(STATUS_SOURCE_WINC(M2M_ERR_TIME_OUT), result, "WINC version did not report the failed page");
+}
+
+void test_winc_download_mode_leave_reports_failed_last_page(void)
+{
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    winc_download_mode(true);
+
+    // The last page written fails verification when it is completed, the WINC must not be restarted
+    spi_flash_flush_StopIgnore();
+    spi_flash_flush_ExpectAndReturn(SPI_FLASH_ERR_VERIFY);
+
+    uint16_t result = winc_download_mode(false);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_VERIFY_FAILED, result, "WINC download mode did not report verify failure");
+
+    // Download mode was kept, leaving it again succeeds once nothing is pending
+    spi_flash_flush_ExpectAndReturn(M2M_SUCCESS);
+    m2m_wifi_init_IgnoreAndReturn(M2M_SUCCESS);
+    m2m_wifi_get_state_IgnoreAndReturn(WIFI_STATE_START);
+
+    result = winc_download_mode(false);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC download mode reported error");
+}
+
+void test_winc_download_mode_leave_reports_flush_timeout(void)
+{
+    // STATUS_SOURCE_WINC = 2, M2M_ERR_TIME_OUT = -4 = 0xFC
+    const uint16_t expected_status = 0x02FC;
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    winc_download_mode(true);
+
+    spi_flash_flush_StopIgnore();
+    spi_flash_flush_ExpectAndReturn(M2M_ERR_TIME_OUT);
+
+    uint16_t result = winc_download_mode(false);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(expected_status, result, "WINC download mode did not report flush failure");
+}
+
+void test_cmd_winc_flashmap_returns_ok(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+    uint8_t entries = 2;
+    uint16_t ids[] = {1, 7};
+    uint32_t offsets[] = {0x1000, 0x80000};
+    uint32_t sizes[] = {0x2000, 0x40000};
+    const char *expected = "1,4096,8192\r\n7,524288,262144\r\n";
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flexible_flash_get_num_entries_ExpectAnyArgsAndReturn(M2M_SUCCESS);
+    spi_flexible_flash_get_num_entries_ReturnThruPtr_pu8Entries(&entries);
+    for (uint8_t i = 0; i < entries; i++) {
+        spi_flexible_flash_get_entry_ExpectAndReturn(i, NULL, NULL, NULL, M2M_SUCCESS);
+        spi_flexible_flash_get_entry_IgnoreArg_pu16Id();
+        spi_flexible_flash_get_entry_IgnoreArg_pu32StartOffset();
+        spi_flexible_flash_get_entry_IgnoreArg_pu32Size();
+        spi_flexible_flash_get_entry_ReturnThruPtr_pu16Id(&ids[i]);
+        spi_flexible_flash_get_entry_ReturnThruPtr_pu32StartOffset(&offsets[i]);
+        spi_flexible_flash_get_entry_ReturnThruPtr_pu32Size(&sizes[i]);
+    }
+
+    uint16_t result = cmd_winc_flashmap(0, NULL, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC flash map reported error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(strlen(expected), data_length, "Incorrect number of bytes received");
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(expected, data, data_length, "Flash map mismatch");
+}
+
+void test_cmd_winc_flashmap_read_error_returns_error(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Just set length to anything but 0 to check that it gets set to 0 by the flash map command implementation
+    uint16_t data_length = 1;
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flexible_flash_get_num_entries_ExpectAnyArgsAndReturn(STATUS_M2M_ERR_FAIL);
+
+    uint16_t result = cmd_winc_flashmap(0, NULL, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(STATUS_MC_M2M_ERR_FAIL, result, "WINC flash map did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC flash map should not return any data on error");
+}
+
+void test_cmd_winc_attest_returns_digest_and_signature(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+    char *argv[WINC_READSTREAM_NUM_ARGS];
+    uint8_t flash[] = "abc";
+    uint8_t signature[WINC_ATTEST_SIGNATURE_SIZE];
+    uint8_t expected[(WINC_ATTEST_DIGEST_SIZE + WINC_ATTEST_SIGNATURE_SIZE) * 2];
+    // SHA-256 of "abc"
+    const char *expected_digest = "BA7816BF8F01CFEA414140DE5DAE2223B00361A396177A9CB410FF61F20015AD";
+
+    populate_readstream_argv(argv, 0x1000, 3);
+    generate_dummy_data(signature, sizeof(signature));
+    memcpy(expected, expected_digest, WINC_ATTEST_DIGEST_SIZE * 2);
+    convert_bin2hex(sizeof(signature), signature, expected + WINC_ATTEST_DIGEST_SIZE * 2);
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_get_size_ExpectAndReturn(4);
+    spi_flash_read_ExpectAndReturn(data, 0x1000, 3, M2M_SUCCESS);
+    spi_flash_read_ReturnArrayThruPtr_pu8Buf(flash, 3);
+    atcab_sign_ExpectAndReturn(0, NULL, NULL, ATCA_SUCCESS);
+    atcab_sign_IgnoreArg_msg();
+    atcab_sign_IgnoreArg_signature();
+    atcab_sign_ReturnArrayThruPtr_signature(signature, sizeof(signature));
+
+    uint16_t result = cmd_winc_attest(WINC_READSTREAM_NUM_ARGS, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC attest reported error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(sizeof(expected), data_length, "Incorrect number of bytes received");
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(expected, data, data_length, "Attestation mismatch");
+}
+
+void test_cmd_winc_attest_sign_error_returns_error(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Just set length to anything but 0 to check that it gets set to 0 by the attest command implementation
+    uint16_t data_length = 1;
+    char *argv[WINC_READSTREAM_NUM_ARGS];
+
+    populate_readstream_argv(argv, 0, 16);
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_get_size_ExpectAndReturn(4);
+    spi_flash_read_ExpectAndReturn(data, 0, 16, M2M_SUCCESS);
+    atcab_sign_ExpectAnyArgsAndReturn(ATCA_EXECUTION_ERROR);
+
+    uint16_t result = cmd_winc_attest(WINC_READSTREAM_NUM_ARGS, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(STATUS_SOURCE_CRYPTOAUTHLIB(ATCA_EXECUTION_ERROR), result, "WINC attest did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC attest should not return any data on error");
+}
+
+void test_cmd_winc_attest_past_end_of_flash_returns_error(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Just set length to anything but 0 to check that it gets set to 0 by the attest command implementation
+    uint16_t data_length = 1;
+    char *argv[WINC_READSTREAM_NUM_ARGS];
+
+    // Starts inside a 4 Mbit flash but ends past it, nothing should be read or signed
+    populate_readstream_argv(argv, WINC_FLASH_4M_SIZE - 16, 32);
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_get_size_ExpectAndReturn(4);
+
+    uint16_t result = cmd_winc_attest(WINC_READSTREAM_NUM_ARGS, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_BAD_ARGUMENT_VALUE, result, "WINC attest did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC attest should not return any data on error");
+}
+
+void test_cmd_winc_fwversion_ota_reads_version_in_download_mode(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+    char *argv[WINC_FWVERSION_NUM_ARGS] = {"OTA"};
+    tstrM2mRev version_info = {0};
+    const char *expected = "WINC firmware 19.7.3\r\nWINC driver 19.3.0\r\n";
+
+    version_info.u8FirmwareMajor = 19;
+    version_info.u8FirmwareMinor = 7;
+    version_info.u8FirmwarePatch = 3;
+    version_info.u8DriverMajor = 19;
+    version_info.u8DriverMinor = 3;
+    version_info.u8DriverPatch = 0;
+
+    mc_match_string_ExpectAndReturn(WINC_FWVERSION_MAIN, argv[WINC_FWVERSION_ARG_IMAGE], 0);
+    mc_match_string_ExpectAndReturn(WINC_FWVERSION_OTA, argv[WINC_FWVERSION_ARG_IMAGE], 1);
+    // No m2m_wifi_init, the WINC firmware is not booted
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    m2m_fwinfo_get_flash_info_ExpectAndReturn(false, NULL, M2M_SUCCESS);
+    m2m_fwinfo_get_flash_info_IgnoreArg_pstrRev();
+    m2m_fwinfo_get_flash_info_ReturnThruPtr_pstrRev(&version_info);
+
+    uint16_t result = cmd_winc_fwversion(WINC_FWVERSION_NUM_ARGS, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC fwversion reported error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(strlen(expected), data_length, "Incorrect number of bytes received");
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(expected, data, data_length, "Version mismatch");
+}
+
+void test_cmd_winc_fwversion_no_control_sector_returns_error(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Just set length to anything but 0 to check that it gets set to 0 by the fwversion command implementation
+    uint16_t data_length = 1;
+    char *argv[WINC_FWVERSION_NUM_ARGS] = {"MAIN"};
+
+    mc_match_string_ExpectAndReturn(WINC_FWVERSION_MAIN, argv[WINC_FWVERSION_ARG_IMAGE], 1);
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    m2m_fwinfo_get_flash_info_ExpectAndReturn(true, NULL, M2M_ERR_FAIL);
+    m2m_fwinfo_get_flash_info_IgnoreArg_pstrRev();
+
+    uint16_t result = cmd_winc_fwversion(WINC_FWVERSION_NUM_ARGS, argv, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(STATUS_MC_M2M_ERR_FAIL, result, "WINC fwversion did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC fwversion should not return any data on error");
+}
+
+void test_cmd_winc_spitune_reports_clock_and_throughput(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    uint16_t data_length = 0;
+    tstrSpiFlashClock clock = {5000000, 412345};
+    const char *expected = "SPI clock 5000000 Hz\r\nThroughput 412345 bytes/s\r\n";
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_tune_clock_ExpectAnyArgsAndReturn(M2M_SUCCESS);
+    spi_flash_tune_clock_ReturnThruPtr_pstrClock(&clock);
+
+    uint16_t result = cmd_winc_spitune(0, NULL, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(MC_STATUS_OK, result, "WINC SPI tune reported error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(strlen(expected), data_length, "Incorrect number of bytes received");
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(expected, data, data_length, "SPI tune report mismatch");
+}
+
+void test_cmd_winc_spitune_link_error_returns_error(void)
+{
+    uint8_t data[MC_DATA_BUFFER_LENGTH];
+    // Just set length to anything but 0 to check that it gets set to 0 by the SPI tune command implementation
+    uint16_t data_length = 1;
+
+    m2m_wifi_get_state_ExpectAndReturn(0);
+    m2m_wifi_download_mode_ExpectAndReturn(0);
+    spi_flash_check_ready_ExpectAndReturn(M2M_SUCCESS);
+    spi_flash_tune_clock_ExpectAnyArgsAndReturn(M2M_ERR_BUS_FAIL);
+
+    uint16_t result = cmd_winc_spitune(0, NULL, data, &data_length);
+
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(STATUS_SOURCE_WINC(M2M_ERR_BUS_FAIL), result, "WINC SPI tune did not report expected error");
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, data_length, "WINC SPI tune should not return any data on error");
+}
+
 #endif // TEST
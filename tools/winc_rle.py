@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""
+Host side compressor for the MC+WINC+WRITECOMPRESSED command of the AVR-IoT provisioning firmware.
+
+The stream format is a simple run-length encoding that can be decompressed one byte at a time on the device:
+    0x00-0x7F: literal, the following (token+1) bytes are copied as is
+    0x80-0xFF: run, the following byte is repeated ((token&0x7F)+1) times
+
+Usage:
+    winc_rle.py <image> [--address ADDRESS]
+
+Prints the MC+WINC+WRITECOMPRESSED commands (command line followed by data blob) needed to write the image
+starting at ADDRESS.  The target range must be erased before the commands are sent.
+"""
+import argparse
+import sys
+
+MAX_TOKEN_LENGTH = 128
+# Shortest run worth encoding as a run token in the middle of literal data
+MIN_RUN_LENGTH = 3
+# Maximum size of the binary stream in one command.  The firmware data buffer holds 1024 hex characters
+MAX_STREAM_LENGTH = 512
+# The decompressed length argument is parsed as a 16-bit value
+MAX_CHUNK_LENGTH = 0xFFFF
+
+
+def _run_length(data, start):
+    """Number of times data[start] is repeated from start, capped at the maximum token length"""
+    end = start + 1
+    while end < len(data) and end - start < MAX_TOKEN_LENGTH and data[end] == data[start]:
+        end += 1
+    return end - start
+
+
+def tokenize(data):
+    """
+    Split data into tokens
+
+    Returns a list of (encoded token, number of decompressed bytes) tuples
+    """
+    tokens = []
+    literal = bytearray()
+
+    def flush_literal():
+        while literal:
+            part = literal[:MAX_TOKEN_LENGTH]
+            del literal[:MAX_TOKEN_LENGTH]
+            tokens.append((bytes([len(part) - 1]) + bytes(part), len(part)))
+
+    index = 0
+    while index < len(data):
+        run = _run_length(data, index)
+        if run >= MIN_RUN_LENGTH or (run == 2 and not literal):
+            flush_literal()
+            tokens.append((bytes([0x80 | (run - 1), data[index]]), run))
+            index += run
+        else:
+            literal.append(data[index])
+            index += 1
+    flush_literal()
+    return tokens
+
+
+def compress(data):
+    """Compress data into a single stream"""
+    return b''.join(token for token, _ in tokenize(data))
+
+
+def decompress(stream):
+    """Reference decompressor, mirrors the firmware implementation"""
+    output = bytearray()
+    index = 0
+    while index < len(stream):
+        token = stream[index]
+        count = (token & 0x7F) + 1
+        index += 1
+        if token & 0x80:
+            output += bytes([stream[index]]) * count
+            index += 1
+        else:
+            output += stream[index:index + count]
+            index += count
+    return bytes(output)
+
+
+def chunks(data, address):
+    """
+    Split data into compressed chunks that each fit in one MC+WINC+WRITECOMPRESSED command
+
+    Yields (address, decompressed length, compressed stream) tuples
+    """
+    stream = bytearray()
+    length = 0
+    for token, count in tokenize(data):
+        if len(stream) + len(token) > MAX_STREAM_LENGTH or length + count > MAX_CHUNK_LENGTH:
+            yield address, length, bytes(stream)
+            address += length
+            stream = bytearray()
+            length = 0
+        stream += token
+        length += count
+    if stream:
+        yield address, length, bytes(stream)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("image", help="binary image to compress")
+    parser.add_argument("--address", type=lambda x: int(x, 0), default=0, help="WINC flash address to write to")
+    args = parser.parse_args()
+
+    with open(args.image, "rb") as image:
+        data = image.read()
+
+    total = 0
+    for address, length, stream in chunks(data, args.address):
+        blob = stream.hex().upper()
+        print("MC+WINC+WRITECOMPRESSED=0x{:X},{},{}".format(address, length, len(blob)))
+        print(blob)
+        total += len(stream)
+
+    print("Compressed {} bytes to {} bytes".format(len(data), total), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
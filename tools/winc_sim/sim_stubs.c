@@ -0,0 +1,155 @@
+/*
+ * Stand-ins for the parts of the firmware the WINC commands use but the simulator doesn't model
+ *
+ * Download mode is entered the way the WINC driver does it, everything else (WINC firmware, ECC, journal, UART) is
+ * reduced to the minimum the flash commands need.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "winc_sim.h"
+#include "sim_stubs.h"
+#include "common/winc_defines.h"
+#include "driver/winc_adapter.h"
+#include "driver/winc_spi.h"
+#include "spi_flash/spi_flash.h"
+#include "m2m/m2m_wifi.h"
+#include "m2m/m2m_fwinfo.h"
+#include "delay.h"
+#include "command_handler/parser/mc_parser.h"
+#include "CryptoAuthenticationLibrary/basic/atca_basic.h"
+#include "winc_journal.h"
+
+static uint8_t *stream_buffer;
+static uint32_t stream_size;
+static uint32_t stream_length;
+
+void sim_stream_capture(uint8_t *buffer, uint32_t size)
+{
+    stream_buffer = buffer;
+    stream_size = size;
+    stream_length = 0;
+}
+
+uint32_t sim_stream_length(void)
+{
+    return stream_length;
+}
+
+uint8_t m2m_wifi_get_state(void)
+{
+    return WIFI_STATE_DEINIT;
+}
+
+int8_t m2m_wifi_download_mode(void)
+{
+    // As m2m_wifi_download_mode does once the chip has been reset and the bus brought up
+    if (WINC_BUS_SUCCESS != winc_bus_init()) {
+        return M2M_ERR_BUS_FAIL;
+    }
+    spi_flash_reset_pipeline();
+    return spi_flash_enable(1);
+}
+
+int8_t m2m_wifi_init(tstrWifiInitParam *pWifiInitParam)
+{
+    (void)pWifiInitParam;
+    return M2M_SUCCESS;
+}
+
+int8_t m2m_wifi_deinit(void *pVArg)
+{
+    (void)pVArg;
+    return M2M_SUCCESS;
+}
+
+int_fast8_t m2m_fwinfo_get_firmware_info(bool bMainImage, tstrM2mRev *pstrRev)
+{
+    (void)bMainImage;
+    memset(pstrRev, 0, sizeof(*pstrRev));
+    return M2M_ERR_FAIL;
+}
+
+int_fast8_t m2m_fwinfo_get_flash_info(bool bMainImage, tstrM2mRev *pstrRev)
+{
+    (void)bMainImage;
+    memset(pstrRev, 0, sizeof(*pstrRev));
+    return M2M_ERR_FAIL;
+}
+
+void DELAY_milliseconds(uint16_t milliseconds)
+{
+    winc_adapter_sleep(milliseconds);
+}
+
+// Same rules as the parser: match is upper case, string is compared case insensitively
+uint8_t mc_match_string(const char *match, const char *string)
+{
+    uint8_t i = 0;
+    while (match[i]) {
+        char c = string[i];
+        if (c >= 'a' && c <= 'z') {
+            c -= 'a' - 'A';
+        }
+        if (match[i] != c) {
+            return 0;
+        }
+        i++;
+    }
+    if (string[i]) {
+        return 0;
+    }
+    return 1;
+}
+
+void mc_stream_data(const uint8_t *data, uint16_t length)
+{
+    if (stream_buffer && stream_length + length <= stream_size) {
+        memcpy(&stream_buffer[stream_length], data, length);
+    }
+    stream_length += length;
+}
+
+ATCA_STATUS atcab_sign(uint16_t key_id, const uint8_t *msg, uint8_t *signature)
+{
+    (void)key_id;
+    (void)msg;
+    memset(signature, 0, 64);
+    return ATCA_SUCCESS;
+}
+
+// No journal session is ever active in the simulator
+void winc_journal_start(uint32_t session_id, const uint8_t *digest)
+{
+    (void)session_id;
+    (void)digest;
+}
+
+void winc_journal_clear(void)
+{
+}
+
+bool winc_journal_active(void)
+{
+    return false;
+}
+
+bool winc_journal_get_session(uint32_t *session_id, uint8_t *digest)
+{
+    (void)session_id;
+    (void)digest;
+    return false;
+}
+
+bool winc_journal_get_range(uint8_t index, winc_journal_range_t *range)
+{
+    (void)index;
+    (void)range;
+    return false;
+}
+
+bool winc_journal_add_sector(uint16_t sector)
+{
+    (void)sector;
+    return true;
+}
@@ -0,0 +1,15 @@
+/*
+ * Stand-ins for firmware modules outside the simulated WINC, see sim_stubs.c
+ */
+
+#ifndef SIM_STUBS_H
+#define SIM_STUBS_H
+
+#include <stdint.h>
+
+// Collect data streamed by commands such as MC+WINC+READSTREAM into buffer (at most size bytes are kept)
+void sim_stream_capture(uint8_t *buffer, uint32_t size);
+// Number of bytes streamed since sim_stream_capture, including any that didn't fit
+uint32_t sim_stream_length(void);
+
+#endif /* SIM_STUBS_H */
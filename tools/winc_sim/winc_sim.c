@@ -0,0 +1,585 @@
+/*
+ * Host side model of a WINC1500 in download mode, see winc_sim.h
+ *
+ * Implements the winc_adapter SPI and timing functions and winc_chip_get_id so the firmware WINC bus and SPI flash
+ * code links against the model instead of the AVR SPI peripheral.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "winc_sim.h"
+#include "driver/winc_adapter.h"
+#include "driver/winc_asic.h"
+#include "common/winc_registers.h"
+
+#define CMD_INTERNAL_WRITE      0xc3
+#define CMD_INTERNAL_READ       0xc4
+#define CMD_DMA_EXT_WRITE       0xc7
+#define CMD_DMA_EXT_READ        0xc8
+#define CMD_SINGLE_WRITE        0xc9
+#define CMD_SINGLE_READ         0xca
+#define CMD_RESET               0xcf
+
+#define DATA_PKT_SZ             (8 * 1024UL)
+
+#define SIM_CHIP_ID             0x1503a0UL
+// Macronix 8 Mbit, the third byte gives the size as a power of two
+#define SIM_FLASH_ID            0x1420c2UL
+
+// Shared memory the host stages flash data in, see spi_flash.c
+#define SIM_RAM_BASE            0xd0000UL
+#define SIM_RAM_SIZE            (64 * 1024UL)
+
+#define SIM_FLASH_PAGE_SZ       256UL
+#define SIM_FLASH_SECTOR_SZ     (4 * 1024UL)
+
+#define SIM_MAX_REGS            32
+// Enough for a DMA read of the largest block the driver requests, plus packet headers
+#define SIM_RSP_SIZE            (SIM_RAM_SIZE + 16)
+
+// Flash status register bits
+#define SIM_FLASH_SR_WIP        0x01
+#define SIM_FLASH_SR_WEL        0x02
+
+// SPI clocks selectable with winc_adapter_spi_set_clock, dividers of F_CPU as in winc_adapter.c
+#define SIM_F_CPU               10000000UL
+static const uint8_t spi_clock_dividers[WINC_ADAPTER_SPI_CLOCK_COUNT] = {16, 8, 4, 2};
+
+typedef enum {
+    SIM_BUS_IDLE,
+    SIM_BUS_COMMAND,
+    SIM_BUS_DATA_HEADER,
+    SIM_BUS_DATA
+} sim_bus_state_t;
+
+typedef struct {
+    uint32_t address;
+    uint32_t value;
+} sim_reg_t;
+
+static winc_sim_config_t config;
+static winc_sim_stats_t stats;
+
+// Simulated time in nanoseconds
+static uint64_t now_ns;
+static uint_fast8_t spi_clock = WINC_ADAPTER_SPI_CLOCK_SAFE;
+
+// SPI slave protocol state
+static bool crc_enabled;
+static sim_bus_state_t bus_state;
+static uint8_t command[16];
+static uint_fast8_t command_length;
+static uint_fast8_t command_expected;
+static uint32_t dma_address;
+static uint32_t dma_remaining;
+static uint32_t packet_remaining;
+
+// Bytes the WINC clocks out on the next host reads
+static uint8_t response[SIM_RSP_SIZE];
+static uint32_t response_head;
+static uint32_t response_tail;
+
+static sim_reg_t regs[SIM_MAX_REGS];
+static uint_fast8_t reg_count;
+
+static uint8_t ram[SIM_RAM_SIZE];
+static uint8_t flash[WINC_SIM_FLASH_SIZE];
+
+// Flash controller and flash state
+static uint64_t transfer_done_ns;
+static uint64_t flash_busy_ns;
+static bool flash_wel;
+
+static void advance_us(uint64_t us)
+{
+    now_ns += us * 1000;
+}
+
+static uint64_t spi_bytes_ns(uint32_t bytes, uint32_t clock_hz)
+{
+    return ((uint64_t)bytes * 8 * 1000000000ULL) / clock_hz;
+}
+
+static bool flash_busy(void)
+{
+    return now_ns < flash_busy_ns;
+}
+
+static void response_clear(void)
+{
+    response_head = 0;
+    response_tail = 0;
+}
+
+static void response_push(uint8_t byte)
+{
+    if (response_tail >= SIM_RSP_SIZE) {
+        stats.protocol_errors++;
+        return;
+    }
+    response[response_tail++] = byte;
+}
+
+// Maps a WINC memory range to the model, only the shared memory the flash code uses is backed
+static uint8_t *ram_map(uint32_t address, uint32_t length)
+{
+    if (address < SIM_RAM_BASE || (address - SIM_RAM_BASE) + length > SIM_RAM_SIZE) {
+        fprintf(stderr, "winc_sim: unmapped WINC memory access %06lx (%lu bytes)\n",
+                (unsigned long)address, (unsigned long)length);
+        stats.protocol_errors++;
+        return NULL;
+    }
+    return &ram[address - SIM_RAM_BASE];
+}
+
+static bool flash_range_valid(uint32_t address, uint32_t length)
+{
+    if (address + length > WINC_SIM_FLASH_SIZE) {
+        stats.protocol_errors++;
+        return false;
+    }
+    return true;
+}
+
+static uint32_t reg_get(uint32_t address)
+{
+    uint_fast8_t i;
+
+    for (i = 0; i < reg_count; i++) {
+        if (regs[i].address == address) {
+            return regs[i].value;
+        }
+    }
+    return 0;
+}
+
+static void reg_set(uint32_t address, uint32_t value)
+{
+    uint_fast8_t i;
+
+    for (i = 0; i < reg_count; i++) {
+        if (regs[i].address == address) {
+            regs[i].value = value;
+            return;
+        }
+    }
+    if (reg_count == SIM_MAX_REGS) {
+        stats.protocol_errors++;
+        return;
+    }
+    regs[reg_count].address = address;
+    regs[reg_count].value = value;
+    reg_count++;
+}
+
+// Executes the command set up in the SPI_FLASH_* registers, started by the write to SPI_FLASH_CMD_CNT
+static void flash_command(uint32_t cmd_cnt)
+{
+    uint32_t buf1 = reg_get(SPI_FLASH_BUF1);
+    uint32_t data_cnt = reg_get(SPI_FLASH_DATA_CNT);
+    uint32_t dma_addr = reg_get(SPI_FLASH_DMA_ADDR);
+    uint8_t opcode = (uint8_t)buf1;
+    // 24 bit flash address in WINC order in the top bytes of BUF1
+    uint32_t address = CONF_WINC_UINT32_SWAP(buf1 & 0xffffff00UL);
+    uint32_t command_bytes = cmd_cnt & 0x7f;
+    uint32_t length;
+    uint32_t i;
+    uint8_t *mem;
+
+    stats.flash_commands++;
+
+    if (now_ns < transfer_done_ns) {
+        // The previous command is still being clocked out to the flash
+        stats.flash_violations++;
+    }
+
+    if (flash_busy() && opcode != 0x05) {
+        // The flash ignores everything but status reads while an erase or program is in progress
+        stats.flash_violations++;
+        transfer_done_ns = now_ns + spi_bytes_ns(command_bytes, config.flash_clock_hz);
+        return;
+    }
+
+    switch (opcode) {
+    case 0x05:
+        // Read status register
+        stats.flash_status_reads++;
+        reg_set(DUMMY_REGISTER, (flash_busy() ? SIM_FLASH_SR_WIP : 0) | (flash_wel ? SIM_FLASH_SR_WEL : 0));
+        break;
+    case 0x9f:
+        // Read ID
+        reg_set(DUMMY_REGISTER, SIM_FLASH_ID);
+        break;
+    case 0x06:
+        flash_wel = true;
+        break;
+    case 0x04:
+        flash_wel = false;
+        break;
+    case 0xb9:
+    case 0xab:
+        // Deep power down and release, nothing to model
+        break;
+    case 0x0b:
+        // Fast read into WINC memory
+        length = data_cnt;
+        mem = ram_map(dma_addr, length);
+        if (mem && flash_range_valid(address, length)) {
+            memcpy(mem, &flash[address], length);
+        }
+        stats.flash_loads++;
+        stats.flash_load_bytes += length;
+        command_bytes += length;
+        break;
+    case 0x20:
+        // Sector erase
+        if (!flash_wel) {
+            stats.flash_violations++;
+            break;
+        }
+        address -= address % SIM_FLASH_SECTOR_SZ;
+        if (flash_range_valid(address, SIM_FLASH_SECTOR_SZ)) {
+            memset(&flash[address], 0xff, SIM_FLASH_SECTOR_SZ);
+        }
+        stats.sectors_erased++;
+        flash_wel = false;
+        flash_busy_ns = now_ns + config.sector_erase_us * 1000ULL;
+        break;
+    case 0x02:
+        // Page program, bits can only be cleared and the address wraps within the page
+        if (!flash_wel) {
+            stats.flash_violations++;
+            break;
+        }
+        length = (cmd_cnt >> 8) & 0xfffff;
+        if (length > SIM_FLASH_PAGE_SZ) {
+            stats.protocol_errors++;
+            length = SIM_FLASH_PAGE_SZ;
+        }
+        mem = ram_map(dma_addr, length);
+        if (mem && flash_range_valid(address, 1)) {
+            uint32_t page = address - address % SIM_FLASH_PAGE_SZ;
+            for (i = 0; i < length; i++) {
+                flash[page + ((address + i) % SIM_FLASH_PAGE_SZ)] &= mem[i];
+            }
+        }
+        stats.pages_programmed++;
+        flash_wel = false;
+        command_bytes += length;
+        flash_busy_ns = now_ns + config.page_program_us * 1000ULL;
+        break;
+    default:
+        fprintf(stderr, "winc_sim: unsupported flash opcode %02x\n", opcode);
+        stats.protocol_errors++;
+        break;
+    }
+
+    transfer_done_ns = now_ns + spi_bytes_ns(command_bytes, config.flash_clock_hz);
+    if (flash_busy_ns > now_ns && flash_busy_ns < transfer_done_ns) {
+        flash_busy_ns = transfer_done_ns;
+    }
+}
+
+static uint32_t reg_read(uint32_t address)
+{
+    switch (address) {
+    case NMI_CHIPID:
+        return SIM_CHIP_ID;
+    case SPI_FLASH_TR_DONE:
+        return (now_ns >= transfer_done_ns) ? 1 : 0;
+    default:
+        return reg_get(address);
+    }
+}
+
+static void reg_write(uint32_t address, uint32_t value)
+{
+    reg_set(address, value);
+
+    if (address == NMI_SPI_PROTOCOL_CONFIG) {
+        // CRC7 enable bits
+        crc_enabled = (value & 0x0c) != 0;
+    } else if (address == SPI_FLASH_CMD_CNT) {
+        flash_command(value);
+    }
+}
+
+static void queue_data(const uint8_t *data, uint32_t length)
+{
+    uint32_t packet;
+    uint8_t header = 0xf1;
+
+    // Packet order in the header: first, middle or last in sequence
+    while (length) {
+        packet = (length > DATA_PKT_SZ) ? DATA_PKT_SZ : length;
+        length -= packet;
+        if (!length) {
+            header = 0xf3;
+        }
+        response_push(header);
+        while (packet--) {
+            response_push(*data++);
+        }
+        header = 0xf2;
+    }
+}
+
+static void command_execute(void)
+{
+    uint8_t value[4];
+    uint32_t address;
+    uint32_t reg;
+    uint8_t *mem;
+
+    response_push(command[0]);
+    response_push(0);
+
+    switch (command[0]) {
+    case CMD_SINGLE_READ:
+    case CMD_INTERNAL_READ:
+        if (command[0] == CMD_INTERNAL_READ) {
+            address = command[2];
+        } else {
+            address = ((uint32_t)command[1] << 16) | ((uint32_t)command[2] << 8) | command[3];
+        }
+        reg = reg_read(address);
+        value[0] = (uint8_t)reg;
+        value[1] = (uint8_t)(reg >> 8);
+        value[2] = (uint8_t)(reg >> 16);
+        value[3] = (uint8_t)(reg >> 24);
+        queue_data(value, 4);
+        stats.reg_reads++;
+        break;
+    case CMD_SINGLE_WRITE:
+    case CMD_INTERNAL_WRITE:
+        if (command[0] == CMD_INTERNAL_WRITE) {
+            address = command[2];
+            memcpy(value, &command[3], 4);
+        } else {
+            address = ((uint32_t)command[1] << 16) | ((uint32_t)command[2] << 8) | command[3];
+            memcpy(value, &command[4], 4);
+        }
+        reg_write(address, ((uint32_t)value[0] << 24) | ((uint32_t)value[1] << 16) | ((uint32_t)value[2] << 8) | value[3]);
+        stats.reg_writes++;
+        break;
+    case CMD_DMA_EXT_READ:
+    case CMD_DMA_EXT_WRITE:
+        dma_address = ((uint32_t)command[1] << 16) | ((uint32_t)command[2] << 8) | command[3];
+        dma_remaining = ((uint32_t)command[4] << 16) | ((uint32_t)command[5] << 8) | command[6];
+        if (!dma_remaining) {
+            stats.protocol_errors++;
+            break;
+        }
+        if (command[0] == CMD_DMA_EXT_READ) {
+            mem = ram_map(dma_address, dma_remaining);
+            if (mem) {
+                queue_data(mem, dma_remaining);
+            }
+            stats.dma_reads++;
+            stats.dma_read_bytes += dma_remaining;
+        } else {
+            bus_state = SIM_BUS_DATA_HEADER;
+            stats.dma_writes++;
+            stats.dma_write_bytes += dma_remaining;
+        }
+        break;
+    case CMD_RESET:
+        stats.bus_resets++;
+        break;
+    default:
+        break;
+    }
+}
+
+static uint_fast8_t command_size(uint8_t cmd)
+{
+    switch (cmd) {
+    case CMD_SINGLE_READ:
+    case CMD_INTERNAL_READ:
+        return 4;
+    case CMD_RESET:
+        return 5;
+    case CMD_INTERNAL_WRITE:
+    case CMD_DMA_EXT_WRITE:
+    case CMD_DMA_EXT_READ:
+        return 7;
+    case CMD_SINGLE_WRITE:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+// Feeds one byte sent by the host through the WINC SPI slave state machine
+static void bus_receive(uint8_t byte)
+{
+    uint8_t *mem;
+
+    switch (bus_state) {
+    case SIM_BUS_IDLE:
+        // Anything that isn't a command (idle bus, stray CRC) is ignored
+        command_expected = command_size(byte);
+        if (command_expected) {
+            command_expected += crc_enabled ? 1 : 0;
+            command[0] = byte;
+            command_length = 1;
+            bus_state = SIM_BUS_COMMAND;
+        }
+        break;
+    case SIM_BUS_COMMAND:
+        command[command_length++] = byte;
+        if (command_length == command_expected) {
+            bus_state = SIM_BUS_IDLE;
+            command_execute();
+        }
+        break;
+    case SIM_BUS_DATA_HEADER:
+        if ((byte & 0xf0) != 0xf0) {
+            stats.protocol_errors++;
+            bus_state = SIM_BUS_IDLE;
+            break;
+        }
+        packet_remaining = (dma_remaining > DATA_PKT_SZ) ? DATA_PKT_SZ : dma_remaining;
+        bus_state = SIM_BUS_DATA;
+        break;
+    case SIM_BUS_DATA:
+        mem = ram_map(dma_address, 1);
+        if (mem) {
+            *mem = byte;
+        }
+        dma_address++;
+        dma_remaining--;
+        if (--packet_remaining == 0) {
+            if (dma_remaining) {
+                bus_state = SIM_BUS_DATA_HEADER;
+            } else {
+                response_push(CMD_INTERNAL_WRITE);
+                response_push(0);
+                bus_state = SIM_BUS_IDLE;
+            }
+        }
+        break;
+    }
+}
+
+static void bus_transfer(size_t size)
+{
+    stats.spi_transfers++;
+    now_ns += config.transfer_overhead_us * 1000ULL;
+    now_ns += spi_bytes_ns(size, winc_adapter_spi_get_clock_hz());
+}
+
+void winc_sim_default_config(winc_sim_config_t *cfg)
+{
+    // Typical datasheet figures for the SPI flash on the WINC1500
+    cfg->page_program_us = 700;
+    cfg->sector_erase_us = 45000;
+    cfg->flash_clock_hz = 20000000UL;
+    cfg->transfer_overhead_us = 5;
+}
+
+void winc_sim_init(const winc_sim_config_t *cfg)
+{
+    config = *cfg;
+    memset(&stats, 0, sizeof(stats));
+    now_ns = 0;
+    spi_clock = WINC_ADAPTER_SPI_CLOCK_SAFE;
+    // The WINC comes out of reset expecting CRC7 on commands until the host turns it off
+    crc_enabled = true;
+    bus_state = SIM_BUS_IDLE;
+    response_clear();
+    reg_count = 0;
+    memset(ram, 0, sizeof(ram));
+    memset(flash, 0xff, sizeof(flash));
+    transfer_done_ns = 0;
+    flash_busy_ns = 0;
+    flash_wel = false;
+}
+
+uint64_t winc_sim_now_us(void)
+{
+    return now_ns / 1000;
+}
+
+void winc_sim_get_stats(winc_sim_stats_t *out)
+{
+    *out = stats;
+}
+
+void winc_sim_reset_stats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+uint8_t *winc_sim_flash(void)
+{
+    return flash;
+}
+
+/*********************************************/
+/* ADAPTER FUNCTIONS                         */
+/*********************************************/
+
+int_fast8_t winc_adapter_spi_write(const uint8_t *puBuf, size_t size)
+{
+    // Whatever the WINC had queued is clocked out while the host writes and is lost
+    response_clear();
+
+    bus_transfer(size);
+    stats.spi_bytes_out += size;
+
+    while (size--) {
+        bus_receive(*puBuf++);
+    }
+
+    return 1;
+}
+
+int_fast8_t winc_adapter_spi_read(uint8_t *puBuf, size_t size)
+{
+    bus_transfer(size);
+    stats.spi_bytes_in += size;
+
+    // The host sends zeros, which the WINC ignores between commands
+    while (size--) {
+        *puBuf++ = (response_head < response_tail) ? response[response_head++] : 0;
+    }
+
+    return 1;
+}
+
+int_fast8_t winc_adapter_spi_set_clock(uint_fast8_t u8Clock)
+{
+    if (u8Clock >= WINC_ADAPTER_SPI_CLOCK_COUNT) {
+        return 0;
+    }
+
+    spi_clock = u8Clock;
+
+    return 1;
+}
+
+uint32_t winc_adapter_spi_get_clock_hz(void)
+{
+    return SIM_F_CPU / spi_clock_dividers[spi_clock];
+}
+
+void winc_adapter_sleep(uint32_t u32TimeMsec)
+{
+    advance_us((uint64_t)u32TimeMsec * 1000);
+}
+
+void winc_adapter_delay_us(uint32_t u32TimeUsec)
+{
+    advance_us(u32TimeUsec);
+}
+
+uint32_t winc_adapter_time_us(void)
+{
+    return (uint32_t)(now_ns / 1000);
+}
+
+uint32_t winc_chip_get_id(void)
+{
+    return SIM_CHIP_ID;
+}
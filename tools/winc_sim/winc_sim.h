@@ -0,0 +1,71 @@
+/*
+ * Host side model of a WINC1500 in download mode
+ *
+ * The model sits behind the winc_adapter SPI functions and implements the WINC SPI command protocol used by
+ * winc_spi.c (single and DMA register/memory access with data packet framing) and the SPI flash controller registers
+ * used by spi_flash.c.  The flash is kept in memory and erase, program and read commands take a configurable amount of
+ * simulated time, so the firmware flash code can be run and measured on a build machine.
+ *
+ * Time is simulated: SPI transfers advance the clock by the time the bytes take on the bus at the selected SPI clock
+ * and the adapter delay functions advance it by the requested time.  Time spent executing firmware code on the AVR is
+ * not included.
+ */
+
+#ifndef WINC_SIM_H
+#define WINC_SIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// 8 Mbit flash as on the WINC1500 modules used on AVR-IoT boards
+#define WINC_SIM_FLASH_SIZE     (1024UL * 1024UL)
+
+typedef struct {
+    // Flash operation durations in microseconds
+    uint32_t page_program_us;
+    uint32_t sector_erase_us;
+    // Clock of the flash SPI interface used for flash to WINC memory transfers
+    uint32_t flash_clock_hz;
+    // Host overhead per SPI transfer (chip select and driver call), in microseconds
+    uint32_t transfer_overhead_us;
+} winc_sim_config_t;
+
+typedef struct {
+    // Host side SPI traffic
+    uint32_t spi_transfers;
+    uint32_t spi_bytes_out;
+    uint32_t spi_bytes_in;
+    // WINC SPI commands
+    uint32_t reg_reads;
+    uint32_t reg_writes;
+    uint32_t dma_reads;
+    uint32_t dma_writes;
+    uint32_t dma_read_bytes;
+    uint32_t dma_write_bytes;
+    uint32_t bus_resets;
+    // Flash controller commands
+    uint32_t flash_commands;
+    uint32_t flash_status_reads;
+    uint32_t flash_loads;
+    uint32_t flash_load_bytes;
+    uint32_t pages_programmed;
+    uint32_t sectors_erased;
+    // Commands the flash ignored because it was still busy, or programs without write enable
+    uint32_t flash_violations;
+    // Protocol errors seen by the model, any non-zero value is a driver or model bug
+    uint32_t protocol_errors;
+} winc_sim_stats_t;
+
+void winc_sim_init(const winc_sim_config_t *config);
+void winc_sim_default_config(winc_sim_config_t *config);
+
+// Simulated time since winc_sim_init
+uint64_t winc_sim_now_us(void);
+
+void winc_sim_get_stats(winc_sim_stats_t *stats);
+void winc_sim_reset_stats(void);
+
+// Direct access to the simulated flash content, for preloading and checking results
+uint8_t *winc_sim_flash(void);
+
+#endif /* WINC_SIM_H */
@@ -0,0 +1,357 @@
+/*
+ * Benchmark of the WINC flash commands against the simulated WINC
+ *
+ * Runs the firmware command handlers for erasing, writing and reading a region of WINC flash the way a host would
+ * drive them over the UART, checks the flash contents after each scenario and prints the simulated bus time and the
+ * traffic it took.  Useful for comparing changes to the WINC bus and SPI flash code without hardware.
+ *
+ * Usage: winc_sim_bench [-c clock] [-s size_kb] [-a address]
+ *  -c: SPI clock setting 0-3 as selected with winc_adapter_spi_set_clock (default 0, the safe clock)
+ *  -s: size of the region in KiB, a multiple of 4 (default 64)
+ *  -a: start address of the region, sector aligned (default 0x40000)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "winc_sim.h"
+#include "sim_stubs.h"
+#include "common/winc_defines.h"
+#include "driver/winc_adapter.h"
+#include "spi_flash/spi_flash.h"
+#include "spi_flash/spi_flash_map.h"
+#include "include/counters.h"
+#include "winc_commands.h"
+#include "conversions.h"
+#include "command_handler/parser/mc_parser.h"
+#include "command_handler/parser/mc_error.h"
+
+// Same signature as the command table entries in mc_commands.h
+typedef uint16_t (*command_handler_t)(uint8_t argc, char *argv[], uint8_t *data, uint16_t *data_length);
+
+typedef bool (*scenario_fn_t)(void);
+
+typedef struct {
+    const char *name;
+    scenario_fn_t run;
+} scenario_t;
+
+static uint32_t region_address = 0x40000;
+static uint32_t region_size = 64 * 1024UL;
+static uint8_t *image;
+static uint8_t *readback;
+static uint8_t *stream;
+static uint8_t data[MC_DATA_BUFFER_LENGTH];
+
+// Runs a command taking an address followed by up to two numeric arguments, the way the parser would pass them
+static uint16_t run_address_command(command_handler_t handler, uint8_t argc, uint32_t address, uint32_t arg1, uint32_t arg2, uint16_t *data_length)
+{
+    char args[3][12];
+    char *argv[3] = {args[0], args[1], args[2]};
+
+    snprintf(args[0], sizeof(args[0]), "0x%" PRIx32, address);
+    snprintf(args[1], sizeof(args[1]), "%" PRIu32, arg1);
+    snprintf(args[2], sizeof(args[2]), "%" PRIu32, arg2);
+
+    return handler(argc, argv, data, data_length);
+}
+
+static bool command_ok(const char *name, uint16_t status)
+{
+    if (status != MC_STATUS_OK) {
+        fprintf(stderr, "%s failed with status %04x\n", name, status);
+        return false;
+    }
+    return true;
+}
+
+// Pseudo random data with erased runs at the end of each sector, like a typical image
+static void make_image(void)
+{
+    uint32_t seed = 0x12345678;
+    uint32_t i;
+
+    for (i = 0; i < region_size; i++) {
+        seed = seed * 1103515245UL + 12345;
+        image[i] = (i % FLASH_SECTOR_SZ) >= (3 * FLASH_SECTOR_SZ / 4) ? 0xff : (uint8_t)(seed >> 16);
+    }
+}
+
+// Leaves stale data in the region so writes without an erase are caught by the check
+static void dirty_region(void)
+{
+    memset(winc_sim_flash() + region_address, 0x5a, region_size);
+}
+
+static bool check_region(const uint8_t *expected)
+{
+    uint32_t i;
+    const uint8_t *flash = winc_sim_flash() + region_address;
+
+    for (i = 0; i < region_size; i++) {
+        if (flash[i] != expected[i]) {
+            fprintf(stderr, "Mismatch at %06" PRIx32 ": %02x expected %02x\n", region_address + i, flash[i], expected[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool erase_sectors(void)
+{
+    uint16_t data_length;
+    uint32_t offset;
+
+    for (offset = 0; offset < region_size; offset += FLASH_SECTOR_SZ) {
+        data_length = 0;
+        if (!command_ok("MC+WINC+ERASESECTOR", run_address_command(cmd_winc_erasesector, 1, region_address + offset, 0, 0, &data_length))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool write_pages(void)
+{
+    uint16_t data_length;
+    uint32_t offset;
+
+    for (offset = 0; offset < region_size; offset += FLASH_PAGE_SZ) {
+        data_length = convert_bin2hex(FLASH_PAGE_SZ, &image[offset], data);
+        if (!command_ok("MC+WINC+WRITE", run_address_command(cmd_winc_writeblob, 3, region_address + offset, FLASH_PAGE_SZ, data_length, &data_length))) {
+            return false;
+        }
+    }
+
+    // Pages are programmed in the background, make sure the last one has landed
+    return spi_flash_flush() == M2M_SUCCESS;
+}
+
+static bool set_mode(command_handler_t handler, const char *name, const char *mode)
+{
+    char mode_arg[8];
+    char *argv[1] = {mode_arg};
+    uint16_t data_length = 0;
+
+    snprintf(mode_arg, sizeof(mode_arg), "%s", mode);
+
+    return command_ok(name, handler(1, argv, data, &data_length));
+}
+
+static bool scenario_erase(void)
+{
+    uint8_t *erased = malloc(region_size);
+    bool ok;
+
+    dirty_region();
+    memset(erased, 0xff, region_size);
+    ok = erase_sectors() && check_region(erased);
+    free(erased);
+
+    return ok;
+}
+
+static bool scenario_erase_write(void)
+{
+    dirty_region();
+    return erase_sectors() && write_pages() && check_region(image);
+}
+
+static bool scenario_write_verify(void)
+{
+    bool ok;
+
+    dirty_region();
+    if (!set_mode(cmd_winc_verify, "MC+WINC+VERIFY", "ON")) {
+        return false;
+    }
+    ok = erase_sectors() && write_pages() && check_region(image);
+    set_mode(cmd_winc_verify, "MC+WINC+VERIFY", "OFF");
+
+    return ok;
+}
+
+static bool scenario_autoerase(const char *mode)
+{
+    bool ok;
+
+    dirty_region();
+    if (!set_mode(cmd_winc_autoerase, "MC+WINC+AUTOERASE", mode)) {
+        return false;
+    }
+    ok = write_pages() && check_region(image);
+    set_mode(cmd_winc_autoerase, "MC+WINC+AUTOERASE", "OFF");
+
+    return ok;
+}
+
+static bool scenario_autoerase_on(void)
+{
+    return scenario_autoerase("ON");
+}
+
+static bool scenario_autoerase_ahead(void)
+{
+    return scenario_autoerase("AHEAD");
+}
+
+static bool scenario_read(void)
+{
+    uint16_t data_length;
+    uint32_t offset;
+
+    for (offset = 0; offset < region_size; offset += FLASH_PAGE_SZ) {
+        data_length = 0;
+        if (!command_ok("MC+WINC+READ", run_address_command(cmd_winc_read, 2, region_address + offset, FLASH_PAGE_SZ, 0, &data_length))) {
+            return false;
+        }
+        if (data_length != FLASH_PAGE_SZ * 2) {
+            return false;
+        }
+        convert_hex2bin(data_length, data, &readback[offset]);
+    }
+
+    return memcmp(readback, image, region_size) == 0;
+}
+
+static bool scenario_readstream(void)
+{
+    uint16_t data_length = 0;
+    uint32_t offset;
+
+    sim_stream_capture(stream, region_size * 2 + 2);
+    if (!command_ok("MC+WINC+READSTREAM", run_address_command(cmd_winc_readstream, 2, region_address, region_size, 0, &data_length))) {
+        return false;
+    }
+    if (sim_stream_length() != region_size * 2 + 2) {
+        return false;
+    }
+    // The stream is checked in chunks as the conversion length is 16 bit
+    for (offset = 0; offset < region_size; offset += FLASH_SECTOR_SZ) {
+        convert_hex2bin(FLASH_SECTOR_SZ * 2, &stream[offset * 2], &readback[offset]);
+    }
+
+    return memcmp(readback, image, region_size) == 0;
+}
+
+static bool scenario_driver_read(void)
+{
+    memset(readback, 0, region_size);
+
+    if (spi_flash_read(readback, region_address, region_size) != M2M_SUCCESS) {
+        return false;
+    }
+
+    return memcmp(readback, image, region_size) == 0;
+}
+
+static const scenario_t scenarios[] = {
+    {"erase",           scenario_erase},
+    {"erase+write",     scenario_erase_write},
+    {"erase+write+vfy", scenario_write_verify},
+    {"autoerase on",    scenario_autoerase_on},
+    {"autoerase ahead", scenario_autoerase_ahead},
+    {"read",            scenario_read},
+    {"readstream",      scenario_readstream},
+    {"spi_flash_read",  scenario_driver_read}
+};
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "Usage: %s [-c clock] [-s size_kb] [-a address]\n", name);
+    exit(2);
+}
+
+int main(int argc, char *argv[])
+{
+    winc_sim_config_t config;
+    winc_sim_stats_t stats;
+    unsigned long clock = WINC_ADAPTER_SPI_CLOCK_SAFE;
+    uint64_t start_us;
+    uint64_t duration_us;
+    bool failed = false;
+    bool ok;
+    size_t i;
+    int arg;
+
+    for (arg = 1; arg < argc; arg++) {
+        if (arg + 1 >= argc) {
+            usage(argv[0]);
+        }
+        if (!strcmp(argv[arg], "-c")) {
+            clock = strtoul(argv[++arg], NULL, 0);
+        } else if (!strcmp(argv[arg], "-s")) {
+            region_size = strtoul(argv[++arg], NULL, 0) * 1024UL;
+        } else if (!strcmp(argv[arg], "-a")) {
+            region_address = strtoul(argv[++arg], NULL, 0);
+        } else {
+            usage(argv[0]);
+        }
+    }
+    if (clock >= WINC_ADAPTER_SPI_CLOCK_COUNT || !region_size || region_size % FLASH_SECTOR_SZ ||
+        region_address % FLASH_SECTOR_SZ || region_address + region_size > WINC_SIM_FLASH_SIZE) {
+        usage(argv[0]);
+    }
+
+    image = malloc(region_size);
+    readback = malloc(region_size);
+    stream = malloc(region_size * 2 + 2);
+    if (!image || !readback || !stream) {
+        return 1;
+    }
+    make_image();
+
+    winc_sim_default_config(&config);
+    winc_sim_init(&config);
+    winc_adapter_spi_set_clock(clock);
+
+    if (winc_download_mode(true) != MC_STATUS_OK) {
+        fprintf(stderr, "Failed to enter download mode\n");
+        return 1;
+    }
+
+    printf("SPI clock %" PRIu32 " Hz, region %06" PRIx32 "-%06" PRIx32 " (%" PRIu32 " KiB)\n\n",
+           winc_adapter_spi_get_clock_hz(), region_address, region_address + region_size - 1, region_size / 1024);
+    printf("%-16s %10s %9s %9s %10s %10s %8s %8s %9s %9s %7s %7s %5s\n",
+           "scenario", "time ms", "KiB/s", "xfers", "bytes out", "bytes in", "reg rd", "reg wr",
+           "dma rd", "dma wr", "pages", "sectors", "viol");
+
+    for (i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        winc_sim_reset_stats();
+        counters_clear();
+        start_us = winc_sim_now_us();
+        ok = scenarios[i].run();
+        duration_us = winc_sim_now_us() - start_us;
+        winc_sim_get_stats(&stats);
+
+        if (stats.flash_violations || stats.protocol_errors) {
+            ok = false;
+        }
+        // The firmware's own counters must agree with what the flash saw
+        if (counters.winc_pages_programmed != stats.pages_programmed ||
+            counters.winc_sectors_erased != stats.sectors_erased) {
+            fprintf(stderr, "%s: firmware counted %" PRIu32 " pages and %" PRIu32 " sectors\n", scenarios[i].name,
+                    counters.winc_pages_programmed, counters.winc_sectors_erased);
+            ok = false;
+        }
+        failed |= !ok;
+
+        printf("%-16s %10.1f %9.1f %9" PRIu32 " %10" PRIu32 " %10" PRIu32 " %8" PRIu32 " %8" PRIu32
+               " %9" PRIu32 " %9" PRIu32 " %7" PRIu32 " %7" PRIu32 " %5" PRIu32 "%s\n",
+               scenarios[i].name, duration_us / 1000.0,
+               duration_us ? (region_size / 1024.0) / (duration_us / 1000000.0) : 0.0,
+               stats.spi_transfers, stats.spi_bytes_out, stats.spi_bytes_in, stats.reg_reads, stats.reg_writes,
+               stats.dma_read_bytes, stats.dma_write_bytes, stats.pages_programmed, stats.sectors_erased,
+               stats.flash_violations + stats.protocol_errors, ok ? "" : "  FAILED");
+    }
+
+    // Leave download mode like a host would at the end of a session
+    winc_download_mode(false);
+
+    free(image);
+    free(readback);
+    free(stream);
+
+    return failed ? 1 : 0;
+}